@@ -93,6 +93,16 @@ void add_cmd(char *name, cmd_func_t operation, char *summary, char *param)
 
 /* Add a new parameter */
 void add_param(char *name, int *valp, char *summary, setter_func_t setter)
+{
+    add_param_labels(name, valp, summary, NULL, setter);
+}
+
+/* Add a new parameter whose values can also be set by the names in labels */
+void add_param_labels(char *name,
+                      int *valp,
+                      char *summary,
+                      const char *const *labels,
+                      setter_func_t setter)
 {
     param_element_t *next_param = param_list;
     param_element_t **last_loc = &param_list;
@@ -106,6 +116,7 @@ void add_param(char *name, int *valp, char *summary, setter_func_t setter)
     param->name = name;
     param->valp = valp;
     param->summary = summary;
+    param->labels = labels;
     param->setter = setter;
     param->next = next_param;
     *last_loc = param;
@@ -262,14 +273,14 @@ static bool do_help(int argc, char *argv[])
     cmd_element_t *clist = cmd_list;
     report(1, "Commands:", argv[0]);
     while (clist) {
-        report(1, "  %-12s%-12s | %s", clist->name, clist->param,
+        report(1, "  %-14s%-12s | %s", clist->name, clist->param,
                clist->summary);
         clist = clist->next;
     }
     param_element_t *plist = param_list;
     report(1, "Options:");
     while (plist) {
-        report(1, "  %-12s%-12d | %s", plist->name, *plist->valp,
+        report(1, "  %-14s%-12d | %s", plist->name, *plist->valp,
                plist->summary);
         plist = plist->next;
     }
@@ -302,14 +313,43 @@ bool get_int(char *vname, int *loc)
     return true;
 }
 
+/* Look up a value name of a labelled parameter */
+static bool get_label(param_element_t *param, char *vname, int *loc)
+{
+    if (!param->labels)
+        return false;
+
+    for (int v = 0; param->labels[v]; v++) {
+        if (!strcmp(param->labels[v], vname)) {
+            *loc = v;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Check that a labelled parameter has a name for value */
+static bool valid_label(param_element_t *param, int value)
+{
+    for (int v = 0; param->labels[v]; v++) {
+        if (v == value)
+            return true;
+    }
+    return false;
+}
+
 static bool do_option(int argc, char *argv[])
 {
     if (argc == 1) {
         param_element_t *plist = param_list;
         report(1, "Options:");
         while (plist) {
-            report(1, "  %-12s%-12d | %s", plist->name, *plist->valp,
-                   plist->summary);
+            if (plist->labels)
+                report(1, "  %-14s%-12s | %s", plist->name,
+                       plist->labels[*plist->valp], plist->summary);
+            else
+                report(1, "  %-14s%-12d | %s", plist->name, *plist->valp,
+                       plist->summary);
             plist = plist->next;
         }
         return true;
@@ -323,14 +363,22 @@ static bool do_option(int argc, char *argv[])
         if (i + 1 >= argc) {
             report(1, "No value given for parameter %s", name);
             return false;
-        } else if (!get_int(argv[++i], &value)) {
-            report(1, "Cannot parse '%s' as integer", argv[i]);
-            return false;
         }
+        i++;
         /* Find parameter in list */
         param_element_t *plist = param_list;
         while (!found && plist) {
             if (strcmp(plist->name, name) == 0) {
+                if (!get_label(plist, argv[i], &value) &&
+                    !get_int(argv[i], &value)) {
+                    report(1, "Cannot parse '%s' as integer", argv[i]);
+                    return false;
+                }
+                if (plist->labels && !valid_label(plist, value)) {
+                    report(1, "Invalid value '%s' for parameter %s", argv[i],
+                           name);
+                    return false;
+                }
                 int oldval = *plist->valp;
                 *plist->valp = value;
                 if (plist->setter)
@@ -35,6 +35,8 @@ typedef struct __param_element {
     char *name;
     int *valp;
     char *summary;
+    /* Optional NULL-terminated names of the values 0, 1, ... */
+    const char *const *labels;
     /* Function that gets called whenever parameter changes */
     setter_func_t setter;
     struct __param_element *next;
@@ -50,6 +52,13 @@ void add_cmd(char *name, cmd_func_t operation, char *summary, char *parameter);
 /* Add a new parameter */
 void add_param(char *name, int *valp, char *summary, setter_func_t setter);
 
+/* Add a new parameter whose values can also be set by the names in labels */
+void add_param_labels(char *name,
+                      int *valp,
+                      char *summary,
+                      const char *const *labels,
+                      setter_func_t setter);
+
 /* Extract integer from text and store at loc */
 bool get_int(char *vname, int *loc);
 
@@ -0,0 +1,34 @@
+#ifndef LAB0_COUNTERS_H
+#define LAB0_COUNTERS_H
+
+#include <stddef.h>
+
+/* Work counters of the sorts, the merges and q_delete_dup(), built in with
+ * 'make STATS=1'.  Otherwise Q_COUNT() expands to nothing and the code that
+ * feeds it is compiled out, so the other builds pay nothing for them.
+ */
+#ifndef Q_STATS
+#define Q_STATS 0
+#endif
+
+/**
+ * struct q_counters - Work done on the calling thread
+ * @cmps: element comparisons
+ * @writes: list pointers written, next and prev links alike
+ * @bytes: string bytes read, the key prefixes of the elements included
+ */
+struct q_counters {
+    size_t cmps;
+    size_t writes;
+    size_t bytes;
+};
+
+#if Q_STATS
+/* Reset by the caller.  q_sort() adds in the work of its helper threads. */
+extern __thread struct q_counters q_counters;
+#define Q_COUNT(field, n) (q_counters.field += (n))
+#else
+#define Q_COUNT(field, n) ((void) 0)
+#endif
+
+#endif /* LAB0_COUNTERS_H */
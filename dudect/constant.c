@@ -12,6 +12,10 @@
  */
 static struct list_head *l = NULL;
 
+/* The queue takes the storage of 'option pool', so the fixtures below also
+ * time the head and tail operations of slab queues, of those with a ring
+ * index, along with the update of the index, and of chunked queues.
+ */
 #define dut_new() ((void) (l = q_new()))
 
 #define dut_size(n)                                \
@@ -34,7 +38,21 @@ static struct list_head *l = NULL;
             q_insert_tail(l, s); \
     } while (0)
 
-#define dut_free() ((void) (q_free(l)))
+/* Both classes must allocate alike, or the allocator and the caches time
+ * the queue length rather than the operation: a second queue holds the
+ * rest of the 10000 elements a measurement may fill
+ */
+static struct list_head *pad = NULL;
+
+#define dut_pad(n)                                   \
+    do {                                             \
+        pad = q_new();                               \
+        int j = 10000 - (n);                         \
+        while (j--)                                  \
+            q_insert_head(pad, get_random_string()); \
+    } while (0)
+
+#define dut_free() ((void) (q_free(pad), q_free(l)))
 
 static char random_string[N_MEASURES][8];
 static int random_string_iter = 0;
@@ -43,6 +61,7 @@ static int random_string_iter = 0;
 void init_dut(void)
 {
     l = NULL;
+    pad = NULL;
 }
 
 static char *get_random_string(void)
@@ -73,7 +92,8 @@ bool measure(int64_t *before_ticks,
              int mode)
 {
     assert(mode == DUT(insert_head) || mode == DUT(insert_tail) ||
-           mode == DUT(remove_head) || mode == DUT(remove_tail));
+           mode == DUT(remove_head) || mode == DUT(remove_tail) ||
+           mode == DUT(delete_mid));
 
     switch (mode) {
     case DUT(insert_head):
@@ -83,6 +103,7 @@ bool measure(int64_t *before_ticks,
             dut_insert_head(
                 get_random_string(),
                 *(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000);
+            dut_pad(*(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000);
             int before_size = q_size(l);
             before_ticks[i] = cpucycles();
             dut_insert_head(s, 1);
@@ -100,6 +121,7 @@ bool measure(int64_t *before_ticks,
             dut_insert_head(
                 get_random_string(),
                 *(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000);
+            dut_pad(*(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000);
             int before_size = q_size(l);
             before_ticks[i] = cpucycles();
             dut_insert_tail(s, 1);
@@ -116,6 +138,7 @@ bool measure(int64_t *before_ticks,
             dut_insert_head(
                 get_random_string(),
                 *(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000 + 1);
+            dut_pad(*(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000 + 1);
             int before_size = q_size(l);
             before_ticks[i] = cpucycles();
             element_t *e = q_remove_head(l, NULL, 0);
@@ -134,6 +157,7 @@ bool measure(int64_t *before_ticks,
             dut_insert_head(
                 get_random_string(),
                 *(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000 + 1);
+            dut_pad(*(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000 + 1);
             int before_size = q_size(l);
             before_ticks[i] = cpucycles();
             element_t *e = q_remove_tail(l, NULL, 0);
@@ -146,12 +170,30 @@ bool measure(int64_t *before_ticks,
                 return false;
         }
         break;
+    case DUT(delete_mid):
+        for (size_t i = DROP_SIZE; i < N_MEASURES - DROP_SIZE; i++) {
+            dut_new();
+            dut_insert_head(
+                get_random_string(),
+                *(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000 + 1);
+            dut_pad(*(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000 + 1);
+            int before_size = q_size(l);
+            before_ticks[i] = cpucycles();
+            bool ok = q_delete_mid(l);
+            after_ticks[i] = cpucycles();
+            int after_size = q_size(l);
+            dut_free();
+            if (!ok || before_size != after_size + 1)
+                return false;
+        }
+        break;
     default:
         for (size_t i = DROP_SIZE; i < N_MEASURES - DROP_SIZE; i++) {
             dut_new();
             dut_insert_head(
                 get_random_string(),
                 *(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000);
+            dut_pad(*(uint16_t *) (input_data + i * CHUNK_SIZE) % 10000);
             before_ticks[i] = cpucycles();
             dut_size(1);
             after_ticks[i] = cpucycles();
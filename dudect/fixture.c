@@ -44,7 +44,11 @@
 #define TEST_TRIES 10
 #define DUDECT_NUMBER_PERCENTILES 100
 
-static t_context_t *t;
+/* One test on every measurement, then one on those below each percentile */
+#define DUDECT_TESTS (1 + DUDECT_NUMBER_PERCENTILES)
+
+static t_context_t t[DUDECT_TESTS];
+static int64_t percentiles[DUDECT_NUMBER_PERCENTILES];
 
 /* threshold values for Welch's t-test */
 enum {
@@ -72,10 +76,10 @@ static int64_t percentile(int64_t *a, double which, size_t size)
  the measurements distribution, but there's not more science
  than that.
 */
-static void prepare_percentiles(t_context_t *ctx, int64_t *exec_times)
+static void prepare_percentiles(int64_t *exec_times)
 {
     for (size_t i = 0; i < DUDECT_NUMBER_PERCENTILES; i++) {
-        ctx->percentiles[i] = percentile(
+        percentiles[i] = percentile(
             exec_times,
             1 - (pow(0.5, 10 * (double) (i + 1) / DUDECT_NUMBER_PERCENTILES)),
             N_MEASURES);
@@ -104,21 +108,43 @@ static void update_statistics(const int64_t *exec_times, uint8_t *classes)
             continue;
 
         /* do a t-test on the execution time */
-        t_push(t, difference, classes[i]);
+        t_push(&t[0], difference, classes[i]);
 
+        /* and on the cropped execution times, each in a test of its own */
         for (size_t crop_index = 0; crop_index < DUDECT_NUMBER_PERCENTILES;
              crop_index++) {
-            if (difference < t->percentiles[crop_index]) {
-                t_push(t, difference, classes[i]);
+            if (difference < percentiles[crop_index]) {
+                t_push(&t[crop_index + 1], difference, classes[i]);
             }
         }
     }
 }
 
+/* The test with the largest t statistic among those with enough measurements,
+ * the uncropped one if none has
+ */
+static t_context_t *max_test(void)
+{
+    t_context_t *ret = &t[0];
+    double max = 0;
+
+    for (size_t i = 0; i < DUDECT_TESTS; i++) {
+        if (t[i].n[0] + t[i].n[1] < ENOUGH_MEASURE)
+            continue;
+        double x = fabs(t_compute(&t[i]));
+        if (max < x) {
+            max = x;
+            ret = &t[i];
+        }
+    }
+    return ret;
+}
+
 static bool report(void)
 {
-    double max_t = fabs(t_compute(t));
-    double number_traces_max_t = t->n[0] + t->n[1];
+    t_context_t *ctx = max_test();
+    double max_t = fabs(t_compute(ctx));
+    double number_traces_max_t = ctx->n[0] + ctx->n[1];
     double max_tau = max_t / sqrt(number_traces_max_t);
 
     printf("\033[A\033[2K");
@@ -161,11 +187,10 @@ static bool doit(int mode)
     int64_t *exec_times = calloc(N_MEASURES, sizeof(int64_t));
     uint8_t *classes = calloc(N_MEASURES, sizeof(uint8_t));
     uint8_t *input_data = calloc(N_MEASURES * CHUNK_SIZE, sizeof(uint8_t));
-    t->percentiles = calloc(DUDECT_NUMBER_PERCENTILES, sizeof(int64_t));
-    bool first_time = t->percentiles[DUDECT_NUMBER_PERCENTILES - 1] == 0;
+    bool first_time = percentiles[DUDECT_NUMBER_PERCENTILES - 1] == 0;
 
     if (!before_ticks || !after_ticks || !exec_times || !classes ||
-        !input_data || !(t->percentiles)) {
+        !input_data) {
         die();
     }
 
@@ -175,7 +200,7 @@ static bool doit(int mode)
     differentiate(exec_times, before_ticks, after_ticks);
 
     if (first_time)
-        prepare_percentiles(t, exec_times);
+        prepare_percentiles(exec_times);
     else {
         update_statistics(exec_times, classes);
         ret &= report();
@@ -186,33 +211,34 @@ static bool doit(int mode)
     free(exec_times);
     free(classes);
     free(input_data);
-    free(t->percentiles);
 
     return ret;
 }
 
+/* Start a try afresh, its first doit() taking the percentiles again */
 static void init_once(void)
 {
     init_dut();
-    t_init(t);
+    for (size_t i = 0; i < DUDECT_TESTS; i++)
+        t_init(&t[i]);
+    memset(percentiles, 0, sizeof(percentiles));
 }
 
 static bool test_const(char *text, int mode)
 {
     bool result = false;
-    t = malloc(sizeof(t_context_t));
 
     for (int cnt = 0; cnt < TEST_TRIES; ++cnt) {
         printf("Testing %s...(%d/%d)\n\n", text, cnt, TEST_TRIES);
         init_once();
-        for (int i = 0; i < ENOUGH_MEASURE / (N_MEASURES - DROP_SIZE * 2) + 1;
+        /* One batch for the percentiles, then enough measurements */
+        for (int i = 0; i < ENOUGH_MEASURE / (N_MEASURES - DROP_SIZE * 2) + 2;
              ++i)
             result = doit(mode);
         printf("\033[A\033[2K\033[A\033[2K");
         if (result)
             break;
     }
-    free(t);
     return result;
 }
 
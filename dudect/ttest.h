@@ -7,7 +7,6 @@ typedef struct {
     double mean[2];
     double m2[2];
     double n[2];
-    int64_t *percentiles;
 } t_context_t;
 
 void t_push(t_context_t *ctx, double x, uint8_t class);
@@ -0,0 +1,222 @@
+/* Workload generator of the 'fuzz' command of qtest */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fuzz.h"
+#include "random.h"
+
+/* Room for one string of the pool, terminator included */
+#define FUZZ_SLOT (FUZZ_MAX_PREFIX + FUZZ_MAX_LEN + 1)
+
+static const char *const run_names[] = {
+    [FUZZ_RUN_ASC] = "ascending",
+    [FUZZ_RUN_DESC] = "descending",
+    [FUZZ_RUN_ALT] = "alternating",
+    [FUZZ_RUN_NONE] = "unordered",
+};
+
+static uint64_t fuzz_rand(uint64_t *rng)
+{
+    *rng += 0x9e3779b97f4a7c15ULL;
+    return random_shuffle(*rng);
+}
+
+/* Uniform in [lo, hi] */
+static int fuzz_range(uint64_t *rng, int lo, int hi)
+{
+    return lo + (int) (fuzz_rand(rng) % (uint64_t) (hi - lo + 1));
+}
+
+/* Halve, double or redraw @x, then clamp it to [lo, hi] */
+static int fuzz_scale(uint64_t *rng, int x, int lo, int hi)
+{
+    switch (fuzz_rand(rng) % 3) {
+    case 0:
+        x /= 2;
+        break;
+    case 1:
+        x *= 2;
+        break;
+    default:
+        x = fuzz_range(rng, lo, hi);
+    }
+    return x < lo ? lo : x > hi ? hi : x;
+}
+
+void fuzz_init(struct fuzz_genome *g, int size, uint64_t *rng)
+{
+    g->seed = fuzz_rand(rng);
+    g->size = size;
+    g->alphabet = fuzz_range(rng, 2, 26);
+    g->min_len = fuzz_range(rng, 1, FUZZ_MAX_LEN / 2);
+    g->max_len = fuzz_range(rng, g->min_len, FUZZ_MAX_LEN);
+    g->prefix = 0;
+    g->distinct = fuzz_scale(rng, 1000, 1, 1000);
+    g->run_len = fuzz_range(rng, 1, size);
+    g->run_order = fuzz_range(rng, 0, FUZZ_RUN_NR - 1);
+    g->noise = fuzz_range(rng, 0, 10);
+}
+
+void fuzz_mutate(struct fuzz_genome *g, uint64_t *rng)
+{
+    for (int genes = fuzz_range(rng, 1, 2); genes; genes--) {
+        switch (fuzz_rand(rng) % 8) {
+        case 0:
+            g->seed = fuzz_rand(rng);
+            break;
+        case 1:
+            g->alphabet = fuzz_scale(rng, g->alphabet, 1, 26);
+            break;
+        case 2:
+            g->min_len = fuzz_range(rng, 1, FUZZ_MAX_LEN);
+            g->max_len = fuzz_range(rng, g->min_len, FUZZ_MAX_LEN);
+            break;
+        case 3:
+            g->prefix = fuzz_scale(rng, g->prefix, 0, FUZZ_MAX_PREFIX);
+            break;
+        case 4:
+            g->distinct = fuzz_scale(rng, g->distinct, 1, 1000);
+            break;
+        case 5:
+            g->run_len = fuzz_scale(rng, g->run_len, 1, g->size);
+            break;
+        case 6:
+            g->run_order = fuzz_range(rng, 0, FUZZ_RUN_NR - 1);
+            break;
+        default:
+            g->noise = fuzz_scale(rng, g->noise, 0, 100);
+        }
+    }
+}
+
+static int cmp_slot(const void *a, const void *b)
+{
+    return strcmp(a, b);
+}
+
+static int cmp_int(const void *a, const void *b)
+{
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+/* The strings are drawn into a sorted pool of distinct * size / 1000 slots,
+ * so that sorting indices into the pool sorts the strings
+ */
+char **fuzz_generate(const struct fuzz_genome *g)
+{
+    int npool = (int) ((int64_t) g->size * g->distinct / 1000);
+    if (npool < 1)
+        npool = 1;
+
+    char **keys = malloc(g->size * sizeof(char *) + npool * FUZZ_SLOT);
+    int *idx = malloc(g->size * sizeof(int));
+    if (!keys || !idx) {
+        free(keys);
+        free(idx);
+        return NULL;
+    }
+    char *pool = (char *) (keys + g->size);
+    uint64_t rng = g->seed;
+
+    char prefix[FUZZ_MAX_PREFIX];
+    for (int i = 0; i < g->prefix; i++)
+        prefix[i] = 'a' + fuzz_range(&rng, 0, g->alphabet - 1);
+    for (int i = 0; i < npool; i++) {
+        char *s = pool + i * FUZZ_SLOT;
+        int len = fuzz_range(&rng, g->min_len, g->max_len);
+        memcpy(s, prefix, g->prefix);
+        for (int j = 0; j < len; j++)
+            s[g->prefix + j] = 'a' + fuzz_range(&rng, 0, g->alphabet - 1);
+        s[g->prefix + len] = '\0';
+    }
+    qsort(pool, npool, FUZZ_SLOT, cmp_slot);
+
+    for (int i = 0, run = 0; i < g->size; i += g->run_len, run++) {
+        int len = g->size - i < g->run_len ? g->size - i : g->run_len;
+        int *r = idx + i;
+        for (int j = 0; j < len; j++)
+            r[j] = fuzz_range(&rng, 0, npool - 1);
+        if (g->run_order == FUZZ_RUN_NONE)
+            continue;
+        qsort(r, len, sizeof(int), cmp_int);
+        if (g->run_order == FUZZ_RUN_DESC ||
+            (g->run_order == FUZZ_RUN_ALT && (run & 1))) {
+            for (int j = 0; j < len / 2; j++) {
+                int t = r[j];
+                r[j] = r[len - 1 - j];
+                r[len - 1 - j] = t;
+            }
+        }
+    }
+
+    for (int n = (int) ((int64_t) g->size * g->noise / 100); n; n--) {
+        int a = fuzz_range(&rng, 0, g->size - 1);
+        int b = fuzz_range(&rng, 0, g->size - 1);
+        int t = idx[a];
+        idx[a] = idx[b];
+        idx[b] = t;
+    }
+
+    for (int i = 0; i < g->size; i++)
+        keys[i] = pool + idx[i] * FUZZ_SLOT;
+    free(idx);
+    return keys;
+}
+
+void fuzz_describe(const struct fuzz_genome *g, char *buf, size_t size)
+{
+    snprintf(buf, size,
+             "%d strings of %d-%d letters a-%c after a prefix of %d, "
+             "%.1f%% distinct, %s runs of %d, %d%% swapped, seed %#llx",
+             g->size, g->min_len, g->max_len, 'a' + g->alphabet - 1, g->prefix,
+             g->distinct / 10.0, run_names[g->run_order], g->run_len,
+             g->noise, (unsigned long long) g->seed);
+}
+
+/* Write each line of @text to @f, prefixed by @lead */
+static void put_lines(FILE *f, const char *lead, const char *text)
+{
+    while (*text) {
+        size_t len = strcspn(text, "\n");
+        fprintf(f, "%s%.*s\n", lead, (int) len, text);
+        text += len + (text[len] == '\n');
+    }
+}
+
+bool fuzz_save(const char *path,
+               const struct fuzz_genome *g,
+               const char *comment,
+               const char *opts,
+               const char *cmds)
+{
+    char **keys = fuzz_generate(g);
+    if (!keys)
+        return false;
+
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        free(keys);
+        return false;
+    }
+
+    put_lines(f, "# ", comment);
+    put_lines(f, "", opts);
+    fprintf(f, "new\n");
+    /* Neighbours that are equal go in one command */
+    for (int i = 0, reps; i < g->size; i += reps) {
+        for (reps = 1; i + reps < g->size; reps++) {
+            if (strcmp(keys[i], keys[i + reps]))
+                break;
+        }
+        if (reps > 1)
+            fprintf(f, "it %s %d\n", keys[i], reps);
+        else
+            fprintf(f, "it %s\n", keys[i]);
+    }
+    put_lines(f, "", cmds);
+    free(keys);
+    return !fclose(f);
+}
@@ -0,0 +1,76 @@
+#ifndef LAB0_FUZZ_H
+#define LAB0_FUZZ_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Workload generator of the 'fuzz' command.  A genome describes how the
+ * strings of a queue are drawn and laid out; the command mutates genomes and
+ * keeps those that make an operation do the most work.
+ */
+
+/* How each run of the input is ordered */
+enum {
+    FUZZ_RUN_ASC,  /* ascending */
+    FUZZ_RUN_DESC, /* descending */
+    FUZZ_RUN_ALT,  /* ascending and descending in turn */
+    FUZZ_RUN_NONE, /* in the order drawn */
+    FUZZ_RUN_NR,
+};
+
+/* Longest string a genome draws, prefix included */
+#define FUZZ_MAX_PREFIX 24
+#define FUZZ_MAX_LEN 16
+
+/**
+ * struct fuzz_genome - Recipe for the strings of one queue
+ * @seed: seed of every random draw below
+ * @size: number of strings
+ * @alphabet: letters the strings are made of, from 'a' on
+ * @min_len: shortest string, prefix excluded
+ * @max_len: longest string, prefix excluded
+ * @prefix: length of a prefix shared by all strings
+ * @distinct: distinct strings per thousand, 1 for nearly all duplicates
+ * @run_len: length of the ordered runs the strings are laid out in
+ * @run_order: FUZZ_RUN_* order of the runs
+ * @noise: strings per hundred swapped with a random other one afterwards
+ */
+struct fuzz_genome {
+    uint64_t seed;
+    int size;
+    int alphabet;
+    int min_len, max_len;
+    int prefix;
+    int distinct;
+    int run_len;
+    int run_order;
+    int noise;
+};
+
+/* Draw a random genome of @size strings */
+void fuzz_init(struct fuzz_genome *g, int size, uint64_t *rng);
+
+/* Change one or two genes of @g at random */
+void fuzz_mutate(struct fuzz_genome *g, uint64_t *rng);
+
+/* Generate the strings of @g.  Returns an array of g->size strings released
+ * with one free() of the array, or NULL if out of memory.
+ */
+char **fuzz_generate(const struct fuzz_genome *g);
+
+/* Describe @g in a line of text */
+void fuzz_describe(const struct fuzz_genome *g, char *buf, size_t size);
+
+/* Write a trace that starts with the lines of @comment as comments and the
+ * commands of @opts, inserts the strings of @g at the tail of a new queue and
+ * runs the commands of @cmds on it.  Lines are separated by '\n'.  Returns
+ * false if the file cannot be written.
+ */
+bool fuzz_save(const char *path,
+               const struct fuzz_genome *g,
+               const char *comment,
+               const char *opts,
+               const char *cmds);
+
+#endif /* LAB0_FUZZ_H */
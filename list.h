@@ -334,6 +334,71 @@ static inline void list_move_tail(struct list_head *node,
     list_add_tail(node, head);
 }
 
+/**
+ * LIST_PREFETCH_DISTANCE - How many nodes the *_prefetch iterators run ahead
+ *
+ * Walking a list is a chain of dependent loads, so prefetching cannot hide
+ * the latency of the chain itself. What it hides is the work done on each
+ * node, e.g. a free() or a string compare, behind the load of a node further
+ * down the list. Define it before including this header to tune it, or as 0
+ * to turn list_prefetch() into a no-op.
+ */
+#ifndef LIST_PREFETCH_DISTANCE
+#define LIST_PREFETCH_DISTANCE 2
+#endif
+
+/**
+ * list_prefetch() - Hint that the memory at an address is read soon
+ * @x: address to fetch into the cache
+ *
+ * Only a hint: it never faults, so @x may be NULL or point past the end of
+ * a null-terminated list.
+ */
+#if LIST_PREFETCH_DISTANCE > 0 && (defined(__GNUC__) || defined(__clang__))
+#define list_prefetch(x) __builtin_prefetch(x)
+#else
+#define list_prefetch(x) ((void) (x))
+#endif
+
+/**
+ * list_prefetch_ahead() - Place a prefetch cursor ahead of a list node
+ * @node: pointer to the node the walk starts from
+ * @head: pointer to the head of the list
+ *
+ * Return: the node LIST_PREFETCH_DISTANCE nodes after @node, or @head if the
+ * list ends first or prefetching is off. Every node on the way is prefetched.
+ */
+static inline struct list_head *list_prefetch_ahead(struct list_head *node,
+                                                    struct list_head *head)
+{
+    /* A cursor on @node itself could be left on a deleted node */
+    if (LIST_PREFETCH_DISTANCE <= 0)
+        return head;
+    for (int i = 0; i < LIST_PREFETCH_DISTANCE && node != head; i++) {
+        node = node->next;
+        list_prefetch(node);
+    }
+    return node;
+}
+
+/**
+ * list_prefetch_next() - Advance a prefetch cursor by one node
+ * @ahead: cursor returned by list_prefetch_ahead() or list_prefetch_next()
+ * @head: pointer to the head of the list
+ *
+ * Return: the node after @ahead, which is prefetched, or @head if @ahead
+ * already reached it
+ */
+static inline struct list_head *list_prefetch_next(struct list_head *ahead,
+                                                   struct list_head *head)
+{
+    if (ahead != head) {
+        ahead = ahead->next;
+        list_prefetch(ahead);
+    }
+    return ahead;
+}
+
 /**
  * list_entry() - Get the entry for this node
  * @node: pointer to list node
@@ -428,6 +493,42 @@ static inline void list_move_tail(struct list_head *node,
          &entry->member != (head); entry = safe,                           \
         safe = list_entry(safe->member.next, __typeof__(*entry), member))
 
+/**
+ * list_for_each_prefetch - Iterate over list nodes, prefetching ahead
+ * @node: list_head pointer used as iterator
+ * @ahead: list_head pointer used as prefetch cursor
+ * @head: pointer to the head of the list
+ *
+ * Like list_for_each, but @ahead runs LIST_PREFETCH_DISTANCE nodes in front
+ * of @node and prefetches each node it reaches. The same restrictions on
+ * modifying the list apply.
+ */
+#define list_for_each_prefetch(node, ahead, head)                   \
+    for (node = (head)->next, ahead = list_prefetch_ahead(node, head); \
+         node != (head);                                               \
+         node = node->next, ahead = list_prefetch_next(ahead, head))
+
+/**
+ * list_for_each_entry_safe_prefetch - Iterate over list entries, allow
+ *                                     deletes and prefetch ahead
+ * @entry: pointer used as iterator
+ * @safe: @type pointer used to store info for next entry in list
+ * @ahead: list_head pointer used as prefetch cursor
+ * @head: pointer to the head of the list
+ * @member: name of the list_head member variable in struct type of @entry
+ *
+ * Like list_for_each_entry_safe, but @ahead runs LIST_PREFETCH_DISTANCE nodes
+ * in front of @entry and prefetches each node it reaches. Only the current
+ * entry may be removed, so the cursor is never left on a deleted node.
+ */
+#define list_for_each_entry_safe_prefetch(entry, safe, ahead, head, member) \
+    for (entry = list_entry((head)->next, __typeof__(*entry), member),       \
+        safe = list_entry(entry->member.next, __typeof__(*entry), member),   \
+        ahead = list_prefetch_ahead(&entry->member, head);                   \
+         &entry->member != (head); entry = safe,                             \
+        safe = list_entry(safe->member.next, __typeof__(*entry), member),    \
+        ahead = list_prefetch_next(ahead, head))
+
 #undef __LIST_HAVE_TYPEOF
 
 #ifdef __cplusplus
@@ -2,6 +2,7 @@
 #ifndef _LINUX_LIST_SORT_H
 #define _LINUX_LIST_SORT_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "list.h"
 
@@ -18,4 +19,8 @@ typedef int
 __attribute__((nonnull(2, 3))) void list_sort(void *priv,
                                               struct list_head *head,
                                               list_cmp_func_t cmp);
+
+__attribute__((nonnull(2, 3))) void list_sort_gallop(void *priv,
+                                                     struct list_head *head,
+                                                     list_cmp_func_t cmp);
 #endif
@@ -0,0 +1,497 @@
+/* SPDX-License-Identifier: GPL-2.0 */
+/*
+ * Template of list_sort(), instantiated once per comparison so that the
+ * comparison can be inlined into the merges instead of being called through
+ * a function pointer.  Define these and include this file:
+ *
+ *   LIST_SORT_NAME          name of the generated sort function, which is
+ *                           static void LIST_SORT_NAME(ctx, head)
+ *   LIST_SORT_CTX           type of the context argument, e.g. a pointer
+ *   LIST_SORT_CMP(ctx,a,b)  expression comparing two list nodes, as the
+ *                           cmp argument of list_sort() does
+ *   LIST_SORT_GALLOP(ctx)   optional, non-zero to merge in galloping mode
+ *   LIST_SORT_WRITES(ctx,n) optional, told of every n list pointers written
+ *
+ * The helper functions are named after LIST_SORT_NAME, so one translation
+ * unit may hold several instances.  The parameters are undefined at the end.
+ */
+
+#include "list_sort.h"
+
+#if !defined(LIST_SORT_NAME) || !defined(LIST_SORT_CTX) || \
+    !defined(LIST_SORT_CMP)
+#error "LIST_SORT_NAME, LIST_SORT_CTX and LIST_SORT_CMP must be defined"
+#endif
+
+#ifndef LIST_SORT_GALLOP
+#define LIST_SORT_GALLOP(ctx) 0
+#endif
+
+#ifndef LIST_SORT_WRITES
+#define LIST_SORT_WRITES(ctx, n) ((void) 0)
+#endif
+
+/* Consecutive wins of one side after which a merge starts galloping */
+#ifndef LIST_SORT_MIN_GALLOP
+#define LIST_SORT_MIN_GALLOP 7
+#endif
+
+#define LIST_SORT_CONCAT_(a, b) a##_##b
+#define LIST_SORT_CONCAT(a, b) LIST_SORT_CONCAT_(a, b)
+#define LIST_SORT_FN(fn) LIST_SORT_CONCAT(LIST_SORT_NAME, fn)
+
+/*
+ * Find the nodes at the front of @run that go before @key: those comparing
+ * <= @key when @run is the 'a' side of a merge, or < @key when it is the
+ * 'b' side, so that ties still go to 'a'.  The run is probed at 1, 3, 7, ...
+ * nodes and the last gap is searched by bisection, which takes O(log n)
+ * comparisons for n such nodes.  Nodes are still walked one by one, as a
+ * list offers nothing better.
+ *
+ * Returns the last of those nodes, NULL if there is none, and their number
+ * in *@n.
+ */
+__attribute__((nonnull(2, 3, 5))) static struct list_head *LIST_SORT_FN(
+    gallop)(LIST_SORT_CTX ctx,
+            struct list_head *run,
+            struct list_head *key,
+            bool run_is_a,
+            size_t *n)
+{
+#define GOES_BEFORE(x)                          \
+    (run_is_a ? LIST_SORT_CMP(ctx, x, key) <= 0 \
+              : LIST_SORT_CMP(ctx, key, x) > 0)
+
+    struct list_head *last = NULL, *probe = run;
+    size_t count = 0, gap = 1;
+
+    /* @last and the @count nodes up to it go before @key; @probe is @gap
+     * nodes after @last
+     */
+    while (GOES_BEFORE(probe)) {
+        last = probe;
+        count += gap;
+        if (!probe->next) {
+            *n = count;
+            return last;
+        }
+        size_t i = 0;
+        for (gap *= 2; i < gap && probe->next; i++)
+            probe = probe->next;
+        gap = i;
+    }
+
+    /* @probe does not go before @key; bisect the gap - 1 nodes in between */
+    struct list_head *start = last ? last->next : run;
+    for (size_t len = gap - 1; len;) {
+        size_t half = (len - 1) / 2;
+        struct list_head *mid = start;
+        for (size_t i = 0; i < half; i++)
+            mid = mid->next;
+        if (GOES_BEFORE(mid)) {
+            last = mid;
+            count += half + 1;
+            start = mid->next;
+            len -= half + 1;
+        } else {
+            len = half;
+        }
+    }
+
+    *n = count;
+    return last;
+#undef GOES_BEFORE
+}
+
+/*
+ * Link the nodes @first to @last after @tail, setting their prev links if
+ * @link_prev, and return the new tail
+ */
+static inline struct list_head *LIST_SORT_FN(splice)(struct list_head *tail,
+                                                     struct list_head *first,
+                                                     struct list_head *last,
+                                                     bool link_prev)
+{
+    tail->next = first;
+    if (!link_prev)
+        return last;
+
+    for (;;) {
+        first->prev = tail;
+        tail = first;
+        if (first == last)
+            return tail;
+        first = first->next;
+    }
+}
+
+/*
+ * Merge in galloping mode, in the way of Timsort: once one side has won
+ * min_gallop times in a row, whole sublists are found by gallop() and
+ * spliced at once, alternating sides until neither finds
+ * LIST_SORT_MIN_GALLOP nodes any more.  min_gallop starts at
+ * LIST_SORT_MIN_GALLOP and adapts to how well galloping pays off.  Sorted
+ * or partially sorted input then costs a logarithmic number of comparisons
+ * per merge.
+ *
+ * The merged nodes are linked after @tail, with their prev links if
+ * @link_prev, until one side runs out.  Returns the last node linked, and
+ * the rest of the other side in *@rest.
+ */
+__attribute__((nonnull(2, 3, 4, 6))) static inline struct list_head *
+LIST_SORT_FN(merge_gallop)(LIST_SORT_CTX ctx,
+                           struct list_head *tail,
+                           struct list_head *a,
+                           struct list_head *b,
+                           bool link_prev,
+                           struct list_head **rest)
+{
+    struct list_head *last;
+    size_t wins_a = 0, wins_b = 0, n_a, n_b;
+    size_t min_gallop = LIST_SORT_MIN_GALLOP;
+
+    for (;;) {
+        list_prefetch(a->next);
+        list_prefetch(b->next);
+        LIST_SORT_WRITES(ctx, 1 + link_prev);
+        /* if equal, take 'a' -- important for sort stability */
+        if (LIST_SORT_CMP(ctx, a, b) <= 0) {
+            tail->next = a;
+            if (link_prev)
+                a->prev = tail;
+            tail = a;
+            a = a->next;
+            if (!a) {
+                *rest = b;
+                return tail;
+            }
+            wins_b = 0;
+            if (++wins_a < min_gallop)
+                continue;
+        } else {
+            tail->next = b;
+            if (link_prev)
+                b->prev = tail;
+            tail = b;
+            b = b->next;
+            if (!b) {
+                *rest = a;
+                return tail;
+            }
+            wins_a = 0;
+            if (++wins_b < min_gallop)
+                continue;
+        }
+
+        do {
+            last = LIST_SORT_FN(gallop)(ctx, a, b, true, &n_a);
+            if (last) {
+                tail = LIST_SORT_FN(splice)(tail, a, last, link_prev);
+                LIST_SORT_WRITES(ctx, 1 + (link_prev ? n_a : 0));
+                a = last->next;
+                if (!a) {
+                    *rest = b;
+                    return tail;
+                }
+            }
+            last = LIST_SORT_FN(gallop)(ctx, b, a, false, &n_b);
+            if (last) {
+                tail = LIST_SORT_FN(splice)(tail, b, last, link_prev);
+                LIST_SORT_WRITES(ctx, 1 + (link_prev ? n_b : 0));
+                b = last->next;
+                if (!b) {
+                    *rest = a;
+                    return tail;
+                }
+            }
+            if (min_gallop > 1)
+                min_gallop--;
+        } while (n_a >= LIST_SORT_MIN_GALLOP || n_b >= LIST_SORT_MIN_GALLOP);
+        /* Make it harder to start galloping again when it did not pay */
+        min_gallop += 2;
+        wins_a = wins_b = 0;
+    }
+}
+
+/*
+ * Returns a list organized in an intermediate format suited
+ * to chaining of merge() calls: null-terminated, no reserved or
+ * sentinel head node, "prev" links not maintained.
+ */
+__attribute__((nonnull(2, 3))) static struct list_head *LIST_SORT_FN(merge)(
+    LIST_SORT_CTX ctx,
+    struct list_head *a,
+    struct list_head *b)
+{
+    struct list_head *head = NULL;
+    struct list_head **tail = &head;
+
+    if (LIST_SORT_GALLOP(ctx)) {
+        struct list_head dummy, *last, *rest;
+        last = LIST_SORT_FN(merge_gallop)(ctx, &dummy, a, b, false, &rest);
+        last->next = rest;
+        LIST_SORT_WRITES(ctx, 1);
+        return dummy.next;
+    }
+
+    /* a and b are independent chains of loads: fetching the node after each
+     * head keeps a miss on both sides in flight
+     */
+    for (;;) {
+        list_prefetch(a->next);
+        list_prefetch(b->next);
+        LIST_SORT_WRITES(ctx, 1);
+        /* if equal, take 'a' -- important for sort stability */
+        if (LIST_SORT_CMP(ctx, a, b) <= 0) {
+            *tail = a;
+            tail = &a->next;
+            a = a->next;
+            if (!a) {
+                *tail = b;
+                break;
+            }
+        } else {
+            *tail = b;
+            tail = &b->next;
+            b = b->next;
+            if (!b) {
+                *tail = a;
+                break;
+            }
+        }
+    }
+    LIST_SORT_WRITES(ctx, 1);
+    return head;
+}
+
+/*
+ * Combine final list merge with restoration of standard doubly-linked
+ * list structure.  This approach duplicates code from merge(), but
+ * runs faster than the tidier alternatives of either a separate final
+ * prev-link restoration pass, or maintaining the prev links
+ * throughout.
+ */
+__attribute__((nonnull(2, 3, 4))) static void LIST_SORT_FN(merge_final)(
+    LIST_SORT_CTX ctx,
+    struct list_head *head,
+    struct list_head *a,
+    struct list_head *b)
+{
+    struct list_head *tail = head;
+    uint8_t count = 0;
+
+    if (LIST_SORT_GALLOP(ctx)) {
+        tail = LIST_SORT_FN(merge_gallop)(ctx, head, a, b, true, &b);
+    } else {
+        for (;;) {
+            list_prefetch(a->next);
+            list_prefetch(b->next);
+            LIST_SORT_WRITES(ctx, 2);
+            /* if equal, take 'a' -- important for sort stability */
+            if (LIST_SORT_CMP(ctx, a, b) <= 0) {
+                tail->next = a;
+                a->prev = tail;
+                tail = a;
+                a = a->next;
+                if (!a)
+                    break;
+            } else {
+                tail->next = b;
+                b->prev = tail;
+                tail = b;
+                b = b->next;
+                if (!b) {
+                    b = a;
+                    break;
+                }
+            }
+        }
+    }
+
+    /* Finish linking remainder of list b on to tail */
+    tail->next = b;
+    do {
+        /*
+         * If the merge is highly unbalanced (e.g. the input is
+         * already sorted), this loop may run many iterations.
+         * Continue callbacks to the client even though no
+         * element comparison is needed, so the client's cmp()
+         * routine can invoke cond_resched() periodically.
+         */
+        if (unlikely(!++count))
+            LIST_SORT_CMP(ctx, b, b);
+        b->prev = tail;
+        tail = b;
+        b = b->next;
+        LIST_SORT_WRITES(ctx, 1);
+    } while (b);
+
+    /* And the final links to make a circular doubly-linked list */
+    tail->next = head;
+    head->prev = tail;
+    LIST_SORT_WRITES(ctx, 3);
+}
+
+/**
+ * LIST_SORT_NAME - sort a list
+ * @ctx: context passed to LIST_SORT_CMP
+ * @head: the list to sort
+ *
+ * The comparison LIST_SORT_CMP(@ctx, @a, @b) must return > 0 if @a should
+ * sort after @b ("@a > @b" if you want an ascending sort), and <= 0 if @a
+ * should sort before @b *or* their original order should be preserved.  It
+ * is always called with the element that came first in the input in @a,
+ * and list_sort is a stable sort, so it is not necessary to distinguish
+ * the @a < @b and @a == @b cases.
+ *
+ * This is compatible with two styles of comparison:
+ * - The traditional style which returns <0 / =0 / >0, or
+ * - Returning a boolean 0/1.
+ * The latter offers a chance to save a few cycles in the comparison
+ * (which is used by e.g. plug_ctx_cmp() in block/blk-mq.c).
+ *
+ * A good way to write a multi-word comparison is::
+ *
+ *	if (a->high != b->high)
+ *		return a->high > b->high;
+ *	if (a->middle != b->middle)
+ *		return a->middle > b->middle;
+ *	return a->low > b->low;
+ *
+ *
+ * This mergesort is as eager as possible while always performing at least
+ * 2:1 balanced merges.  Given two pending sublists of size 2^k, they are
+ * merged to a size-2^(k+1) list as soon as we have 2^k following elements.
+ *
+ * Thus, it will avoid cache thrashing as long as 3*2^k elements can
+ * fit into the cache.  Not quite as good as a fully-eager bottom-up
+ * mergesort, but it does use 0.2*n fewer comparisons, so is faster in
+ * the common case that everything fits into L1.
+ *
+ *
+ * The merging is controlled by "count", the number of elements in the
+ * pending lists.  This is beautifully simple code, but rather subtle.
+ *
+ * Each time we increment "count", we set one bit (bit k) and clear
+ * bits k-1 .. 0.  Each time this happens (except the very first time
+ * for each bit, when count increments to 2^k), we merge two lists of
+ * size 2^k into one list of size 2^(k+1).
+ *
+ * This merge happens exactly when the count reaches an odd multiple of
+ * 2^k, which is when we have 2^k elements pending in smaller lists,
+ * so it's safe to merge away two lists of size 2^k.
+ *
+ * After this happens twice, we have created two lists of size 2^(k+1),
+ * which will be merged into a list of size 2^(k+2) before we create
+ * a third list of size 2^(k+1), so there are never more than two pending.
+ *
+ * The number of pending lists of size 2^k is determined by the
+ * state of bit k of "count" plus two extra pieces of information:
+ *
+ * - The state of bit k-1 (when k == 0, consider bit -1 always set), and
+ * - Whether the higher-order bits are zero or non-zero (i.e.
+ *   is count >= 2^(k+1)).
+ *
+ * There are six states we distinguish.  "x" represents some arbitrary
+ * bits, and "y" represents some arbitrary non-zero bits:
+ * 0:  00x: 0 pending of size 2^k;           x pending of sizes < 2^k
+ * 1:  01x: 0 pending of size 2^k; 2^(k-1) + x pending of sizes < 2^k
+ * 2: x10x: 0 pending of size 2^k; 2^k     + x pending of sizes < 2^k
+ * 3: x11x: 1 pending of size 2^k; 2^(k-1) + x pending of sizes < 2^k
+ * 4: y00x: 1 pending of size 2^k; 2^k     + x pending of sizes < 2^k
+ * 5: y01x: 2 pending of size 2^k; 2^(k-1) + x pending of sizes < 2^k
+ * (merge and loop back to state 2)
+ *
+ * We gain lists of size 2^k in the 2->3 and 4->5 transitions (because
+ * bit k-1 is set while the more significant bits are non-zero) and
+ * merge them away in the 5->2 transition.  Note in particular that just
+ * before the 5->2 transition, all lower-order bits are 11 (state 3),
+ * so there is one list of each smaller size.
+ *
+ * When we reach the end of the input, we merge all the pending
+ * lists, from smallest to largest.  If you work through cases 2 to
+ * 5 above, you can see that the number of elements we merge with a list
+ * of size 2^k varies from 2^(k-1) (cases 3 and 5 when x == 0) to
+ * 2^(k+1) - 1 (second merge of case 5 when x == 2^(k-1) - 1).
+ */
+__attribute__((nonnull(2))) static void LIST_SORT_NAME(LIST_SORT_CTX ctx,
+                                                      struct list_head *head)
+{
+    struct list_head *list = head->next, *pending = NULL;
+    size_t count = 0; /* Count of pending */
+
+    if (list == head->prev) /* Zero or one elements */
+        return;
+
+    /* Convert to a null-terminated singly-linked list. */
+    head->prev->next = NULL;
+    LIST_SORT_WRITES(ctx, 1);
+
+    /*
+     * Data structure invariants:
+     * - All lists are singly linked and null-terminated; prev
+     *   pointers are not maintained.
+     * - pending is a prev-linked "list of lists" of sorted
+     *   sublists awaiting further merging.
+     * - Each of the sorted sublists is power-of-two in size.
+     * - Sublists are sorted by size and age, smallest & newest at front.
+     * - There are zero to two sublists of each size.
+     * - A pair of pending sublists are merged as soon as the number
+     *   of following pending elements equals their size (i.e.
+     *   each time count reaches an odd multiple of that size).
+     *   That ensures each later final merge will be at worst 2:1.
+     * - Each round consists of:
+     *   - Merging the two sublists selected by the highest bit
+     *     which flips when count is incremented, and
+     *   - Adding an element from the input as a size-1 sublist.
+     */
+    do {
+        size_t bits;
+        struct list_head **tail = &pending;
+
+        /* Find the least-significant clear bit in count */
+        for (bits = count; bits & 1; bits >>= 1)
+            tail = &(*tail)->prev;
+        /* Do the indicated merge */
+        if (likely(bits)) {
+            struct list_head *a = *tail, *b = a->prev;
+
+            a = LIST_SORT_FN(merge)(ctx, b, a);
+            /* Install the merged result in place of the inputs */
+            a->prev = b->prev;
+            *tail = a;
+            LIST_SORT_WRITES(ctx, 2);
+        }
+
+        /* Move one element from input list to pending */
+        list->prev = pending;
+        pending = list;
+        list = list->next;
+        pending->next = NULL;
+        LIST_SORT_WRITES(ctx, 2);
+        count++;
+    } while (list);
+
+    /* End of input; merge together all the pending lists. */
+    list = pending;
+    pending = pending->prev;
+    for (;;) {
+        struct list_head *next = pending->prev;
+
+        if (!next)
+            break;
+        list = LIST_SORT_FN(merge)(ctx, pending, list);
+        pending = next;
+    }
+    /* The final merge, rebuilding prev links */
+    LIST_SORT_FN(merge_final)(ctx, head, pending, list);
+}
+
+#undef LIST_SORT_FN
+#undef LIST_SORT_GALLOP
+#undef LIST_SORT_WRITES
+#undef LIST_SORT_CONCAT
+#undef LIST_SORT_CONCAT_
+#undef LIST_SORT_CMP
+#undef LIST_SORT_CTX
+#undef LIST_SORT_NAME
@@ -20,6 +20,7 @@
 #endif
 
 #include "dudect/fixture.h"
+#include "fuzz.h"
 #include "list.h"
 #include "random.h"
 
@@ -72,6 +73,20 @@ static int fail_count = 0;
 
 static int string_length = MAXSTRING;
 
+/* Report comparisons and time per element of each sort command */
+static int bench = 0;
+
+/* Report the engine and time of each q_sort, and what 'auto' sampled */
+static int sortstats = 0;
+
+/* Names of the q_sort engines, indexed by Q_SORT_* */
+static const char *const sortalgo_labels[] = {"merge", "radix", "list", "auto",
+                                              NULL};
+
+/* Where new queues get their elements from, indexed by q_pool_mode */
+static const char *const pool_labels[] = {"malloc",    "slab",  "compact",
+                                          "ringindex", "chunk", NULL};
+
 #define MIN_RANDSTR_LEN 5
 #define MAX_RANDSTR_LEN 10
 static const char charset[] = "abcdefghijklmnopqrstuvwxyz";
@@ -79,6 +94,63 @@ static const char charset[] = "abcdefghijklmnopqrstuvwxyz";
 /* Forward declarations */
 static bool q_show(int vlevel);
 
+static void report_bench(char *op, int cnt, size_t cmps, double elapsed)
+{
+    if (!bench || cnt < 1)
+        return;
+    report(1, "%s %d elements: %zu comparisons, %.1f ns/element", op, cnt,
+           cmps, elapsed * 1e9 / cnt);
+#if KEY_PREFIX
+    /* Comparisons the key prefixes could not decide on their own */
+    report(1, "Key prefix ties: %zu (%.2f%% of comparisons)", q_key_ties,
+           cmps ? 100.0 * q_key_ties / cmps : 0.0);
+#endif
+}
+
+static void report_sortstats(int cnt, double elapsed)
+{
+    const struct q_sort_stats *st = &q_sort_stats;
+
+    if (!sortstats || cnt < 2)
+        return;
+    if (st->presorted) {
+        report(1, "Sort skipped, queue known to be sorted: %.3f ms",
+               elapsed * 1e3);
+        return;
+    }
+    report(1, "Sort engine %s%s: %.3f ms, %.1f ns/element",
+           st->algo == Q_SORT_RING ? "ring" : sortalgo_labels[st->algo],
+           q_sort_algo == Q_SORT_AUTO ? " (auto)" : "", elapsed * 1e3,
+           elapsed * 1e9 / cnt);
+    if (st->sampled)
+        report(1,
+               "Sampled %zu elements in %.1f us: %zu of %zu neighbours "
+               "descending, %zu duplicates, key length %.1f, common prefix "
+               "%.1f, %zu distinct bytes, radix depth %.1f",
+               st->sampled, st->sample_time * 1e6, st->descents, st->pairs,
+               st->dups, st->key_len, st->prefix, st->alphabet, st->depth);
+}
+
+#if Q_STATS
+static void reset_counters()
+{
+    memset(&q_counters, 0, sizeof(q_counters));
+}
+
+/* Report the work counted since reset_counters() in a 'make STATS=1' build */
+static void report_counters(const char *op, double elapsed)
+{
+    report(1,
+           "%s: %zu comparisons, %zu pointer writes, %zu string bytes read, "
+           "%.3f ms",
+           op, q_counters.cmps, q_counters.writes, q_counters.bytes,
+           elapsed * 1e3);
+}
+#else
+static inline void reset_counters() {}
+static inline void report_counters(const char *op, double elapsed) {}
+#endif
+
 static bool do_free(int argc, char *argv[])
 {
     if (argc != 1) {
@@ -134,13 +206,37 @@ static bool do_free(int argc, char *argv[])
 
 static bool do_new(int argc, char *argv[])
 {
-    if (argc != 1) {
-        report(1, "%s takes no arguments", argv[0]);
+    if (argc > 3) {
+        report(1, "%s takes 0-2 arguments", argv[0]);
         return false;
     }
 
+    /* The storage and interning of this queue only, 'option pool' and
+     * 'option intern' by default
+     */
+    int pool = q_pool_mode, intern = q_intern_mode;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "intern")) {
+            intern = 1;
+            continue;
+        }
+        pool = 0;
+        while (pool_labels[pool] && strcmp(argv[i], pool_labels[pool]))
+            pool++;
+        if (!pool_labels[pool]) {
+            report(1,
+                   "Unknown storage '%s', one of malloc, slab, compact, "
+                   "ringindex or chunk",
+                   argv[i]);
+            return false;
+        }
+    }
+
     bool ok = true;
+    int saved_pool = q_pool_mode, saved_intern = q_intern_mode;
 
+    q_pool_mode = pool;
+    q_intern_mode = intern;
     if (exception_setup(true)) {
         queue_contex_t *qctx = malloc(sizeof(queue_contex_t));
         list_add_tail(&qctx->chain, &chain.head);
@@ -152,6 +248,8 @@ static bool do_new(int argc, char *argv[])
         current = qctx;
     }
     exception_cancel();
+    q_pool_mode = saved_pool;
+    q_intern_mode = saved_intern;
     q_show(3);
 
     return ok && !error_check();
@@ -224,7 +322,7 @@ static bool do_ih(int argc, char *argv[])
             if (rval) {
                 current->size++;
                 char *cur_inserts =
-                    list_entry(current->q->next, element_t, list)->value;
+                    list_entry(q_first(current->q), element_t, list)->value;
                 if (!cur_inserts) {
                     report(1, "ERROR: Failed to save copy of string in queue");
                     ok = false;
@@ -234,7 +332,8 @@ static bool do_ih(int argc, char *argv[])
                            "queue element");
                     ok = false;
                     break;
-                } else if (r == 1 && lasts == cur_inserts) {
+                } else if (r == 1 && lasts == cur_inserts &&
+                           !q_intern_stats(current->q, NULL)) {
                     report(1,
                            "ERROR: Need to allocate separate string for each "
                            "queue element");
@@ -313,7 +412,7 @@ static bool do_it(int argc, char *argv[])
             if (rval) {
                 current->size++;
                 char *cur_inserts =
-                    list_entry(current->q->prev, element_t, list)->value;
+                    list_entry(q_last(current->q), element_t, list)->value;
                 if (!cur_inserts) {
                     report(1, "ERROR: Failed to save copy of string in queue");
                     ok = false;
@@ -480,8 +579,13 @@ static bool do_dedup(int argc, char *argv[])
     LIST_HEAD(l_copy);
     element_t *item = NULL, *tmp = NULL;
 
+    /* The copy doubles the blocks each free() would have to search */
+    if (current->size > BIG_LIST_SIZE)
+        set_cautious_mode(false);
+
     // Copy current->q to l_copy
     if (current->q && !list_empty(current->q)) {
+        q_straighten(current->q);
         list_for_each_entry (item, current->q, list) {
             size_t slen;
             tmp = malloc(sizeof(element_t));
@@ -503,6 +607,7 @@ static bool do_dedup(int argc, char *argv[])
                 free(item->value);
                 free(item);
             }
+            set_cautious_mode(true);
             report(1,
                    "INTERNAL ERROR.  Could not allocate space for "
                    "duplicate checking");
@@ -511,15 +616,20 @@ static bool do_dedup(int argc, char *argv[])
     }
 
     bool ok = true;
+    double start;
+    init_time(&start);
+    reset_counters();
     if (exception_setup(true))
         ok = q_delete_dup(current->q);
     exception_cancel();
+    report_counters("dedup", delta_time(&start));
 
     if (!ok) {
         list_for_each_entry_safe (item, tmp, &l_copy, list) {
             free(item->value);
             free(item);
         }
+        set_cautious_mode(true);
         report(1, "ERROR: Calling delete duplicate on null queue");
         return false;
     }
@@ -555,6 +665,7 @@ static bool do_dedup(int argc, char *argv[])
         free(item->value);
         free(item);
     }
+    set_cautious_mode(true);
 
     q_show(3);
     return ok && !error_check();
@@ -629,6 +740,174 @@ static bool do_size(int argc, char *argv[])
     return ok && !error_check();
 }
 
+static bool do_mem(int argc, char *argv[])
+{
+    if (argc != 1) {
+        report(1, "%s takes no arguments", argv[0]);
+        return false;
+    }
+
+    if (!current || !current->q) {
+        report(3, "Warning: Calling mem on null queue");
+        return !error_check();
+    }
+
+    int cnt = q_size(current->q);
+    size_t bytes = q_footprint(current->q);
+    report(1, "Queue memory = %zu bytes, %.1f bytes/element", bytes,
+           cnt ? (double) bytes / cnt : 0.0);
+
+    struct q_intern_stats st;
+    if (q_intern_stats(current->q, &st))
+        report(1,
+               "Interned %zu strings for %zu elements: %zu bytes saved, %zu "
+               "bytes of table overhead",
+               st.strings, st.refs, st.saved, st.overhead);
+
+    return !error_check();
+}
+
+/*-------------------------------------sort orders------------------------------------------*/
+static size_t list_sort_cmps = 0;
+
+/* Orders list_sort can sort in, selected by 'option order' */
+enum { ORDER_ASC, ORDER_DESC, ORDER_LEN, ORDER_INT };
+static const char *const order_labels[] = {"asc", "desc", "len", "int", NULL};
+static int sort_order = ORDER_ASC;
+
+/* Call the comparison of list_sort through a function pointer */
+static int lsort_generic = 0;
+
+/* Merge in galloping mode in list_sort */
+static int lsort_gallop = 0;
+
+static inline int order_asc(const element_t *a, const element_t *b)
+{
+    return element_cmp(a, b);
+}
+
+static inline int order_desc(const element_t *a, const element_t *b)
+{
+    return element_cmp(b, a);
+}
+
+/* Shorter strings first, equal lengths in ascending order */
+static inline int order_len(const element_t *a, const element_t *b)
+{
+    size_t la = strlen(a->value), lb = strlen(b->value);
+    Q_COUNT(bytes, la + lb + 2);
+    if (la != lb)
+        return la < lb ? -1 : 1;
+    return element_cmp(a, b);
+}
+
+/* Strings as decimal integers of any length: an optional sign and the
+ * digits that follow, compared without converting them
+ */
+static inline int order_int(const element_t *a, const element_t *b)
+{
+    const char *x = a->value, *y = b->value;
+    bool neg_x = *x == '-', neg_y = *y == '-';
+
+    x += neg_x || *x == '+';
+    y += neg_y || *y == '+';
+    while (*x == '0')
+        x++;
+    while (*y == '0')
+        y++;
+
+    size_t len_x = strspn(x, "0123456789"), len_y = strspn(y, "0123456789");
+    /* Signs, leading zeros and the digits strspn() read */
+    Q_COUNT(bytes, x - a->value + y - b->value + len_x + len_y);
+    /* Zero has no sign */
+    neg_x &= len_x > 0;
+    neg_y &= len_y > 0;
+    if (neg_x != neg_y)
+        return neg_x ? -1 : 1;
+
+    int c = len_x != len_y ? (len_x < len_y ? -1 : 1) : strncmp(x, y, len_x);
+    return neg_x ? -c : c;
+}
+
+/* Instances of list_sort with the order inlined, counting comparisons
+ * through their context
+ */
+#define ORDER_CMP(order, ctx, a, b)                                      \
+    ((*(ctx))++, Q_COUNT(cmps, 1), order(list_entry(a, element_t, list), \
+                                         list_entry(b, element_t, list)))
+
+#define LIST_SORT_NAME list_sort_asc
+#define LIST_SORT_CTX size_t *
+#define LIST_SORT_CMP(ctx, a, b) ORDER_CMP(order_asc, ctx, a, b)
+#define LIST_SORT_GALLOP(ctx) lsort_gallop
+#define LIST_SORT_WRITES(ctx, n) Q_COUNT(writes, n)
+#include "list_sort_template.h"
+
+#define LIST_SORT_NAME list_sort_desc
+#define LIST_SORT_CTX size_t *
+#define LIST_SORT_CMP(ctx, a, b) ORDER_CMP(order_desc, ctx, a, b)
+#define LIST_SORT_GALLOP(ctx) lsort_gallop
+#define LIST_SORT_WRITES(ctx, n) Q_COUNT(writes, n)
+#include "list_sort_template.h"
+
+#define LIST_SORT_NAME list_sort_len
+#define LIST_SORT_CTX size_t *
+#define LIST_SORT_CMP(ctx, a, b) ORDER_CMP(order_len, ctx, a, b)
+#define LIST_SORT_GALLOP(ctx) lsort_gallop
+#define LIST_SORT_WRITES(ctx, n) Q_COUNT(writes, n)
+#include "list_sort_template.h"
+
+#define LIST_SORT_NAME list_sort_int
+#define LIST_SORT_CTX size_t *
+#define LIST_SORT_CMP(ctx, a, b) ORDER_CMP(order_int, ctx, a, b)
+#define LIST_SORT_GALLOP(ctx) lsort_gallop
+#define LIST_SORT_WRITES(ctx, n) Q_COUNT(writes, n)
+#include "list_sort_template.h"
+
+/* Comparisons for the generic list_sort() */
+#define DEFINE_ORDER_CMP(order)                                   \
+    static int cmp_##order(void *priv, const struct list_head *a, \
+                           const struct list_head *b)             \
+    {                                                             \
+        return ORDER_CMP(order_##order, &list_sort_cmps, a, b);   \
+    }
+
+DEFINE_ORDER_CMP(asc)
+DEFINE_ORDER_CMP(desc)
+DEFINE_ORDER_CMP(len)
+DEFINE_ORDER_CMP(int)
+
+static const struct {
+    int (*order)(const element_t *a, const element_t *b);
+    list_cmp_func_t cmp;
+    void (*sort)(size_t *cmps, struct list_head *head);
+    const char *name;
+} orders[] = {
+    [ORDER_ASC] = {order_asc, cmp_asc, list_sort_asc, "ascending"},
+    [ORDER_DESC] = {order_desc, cmp_desc, list_sort_desc, "descending"},
+    [ORDER_LEN] = {order_len, cmp_len, list_sort_len, "length"},
+    [ORDER_INT] = {order_int, cmp_int, list_sort_int, "integer"},
+};
+
+/* Ensure the first @cnt elements of @head are sorted in @order */
+static bool check_sorted(struct list_head *head, int cnt, int order)
+{
+    if (!cnt)
+        return true;
+
+    for (struct list_head *cur_l = q_first(head); cur_l != head && --cnt;
+         cur_l = q_next(head, cur_l)) {
+        element_t *item, *next_item;
+        item = list_entry(cur_l, element_t, list);
+        next_item = list_entry(q_next(head, cur_l), element_t, list);
+        if (orders[order].order(item, next_item) > 0) {
+            report(1, "ERROR: Not sorted in %s order", orders[order].name);
+            return false;
+        }
+    }
+    return true;
+}
+
 bool do_sort(int argc, char *argv[])
 {
     if (argc != 1) {
@@ -647,31 +926,99 @@ bool do_sort(int argc, char *argv[])
         report(3, "Warning: Calling sort on single node");
     error_check();
 
+    double start;
+    init_time(&start);
+    q_key_ties = 0;
+    reset_counters();
     set_noallocate_mode(true);
     if (current && exception_setup(true))
         q_sort(current->q);
     exception_cancel();
     set_noallocate_mode(false);
+    double elapsed = delta_time(&start);
+    report_bench("Sorted", cnt, q_sort_cmps, elapsed);
+    report_sortstats(cnt, elapsed);
+    report_counters("sort", elapsed);
 
+    /* q_sort() always sorts in ascending order */
     bool ok = true;
-    if (current && current->size) {
-        for (struct list_head *cur_l = current->q->next;
-             cur_l != current->q && --cnt; cur_l = cur_l->next) {
-            /* Ensure each element in ascending order */
-            /* FIXME: add an option to specify sorting order */
-            element_t *item, *next_item;
-            item = list_entry(cur_l, element_t, list);
-            next_item = list_entry(cur_l->next, element_t, list);
-            if (strcmp(item->value, next_item->value) > 0) {
-                report(1, "ERROR: Not sorted in ascending order");
+    if (current && current->size)
+        ok = check_sorted(current->q, cnt, ORDER_ASC);
+
+    q_show(3);
+    return ok && !error_check();
+}
+
+/* insert in order */
+static bool do_is(int argc, char *argv[])
+{
+    char randstr_buf[MAX_RANDSTR_LEN];
+    int reps = 1;
+    bool ok = true, need_rand = false;
+    if (argc != 2 && argc != 3) {
+        report(1, "%s needs 1-2 arguments", argv[0]);
+        return false;
+    }
+
+    char *inserts = argv[1];
+    if (argc == 3) {
+        if (!get_int(argv[2], &reps)) {
+            report(1, "Invalid number of insertions '%s'", argv[2]);
+            return false;
+        }
+    }
+
+    if (!strcmp(inserts, "RAND")) {
+        need_rand = true;
+        inserts = randstr_buf;
+    }
+
+    if (!current || !current->q)
+        report(3, "Warning: Calling insert sorted on null queue");
+    error_check();
+
+    double start, elapsed = 0;
+    size_t cmps = 0;
+    q_key_ties = 0;
+    reset_counters();
+    if (current && exception_setup(true)) {
+        for (int r = 0; ok && r < reps; r++) {
+            if (need_rand)
+                fill_rand_string(randstr_buf, sizeof(randstr_buf));
+            init_time(&start);
+            bool rval = q_insert_sorted(current->q, inserts);
+            elapsed += delta_time(&start);
+            cmps += q_sort_cmps;
+            if (rval) {
+                current->size++;
+            } else if (current->q && !q_sorted(current->q)) {
+                report(1, "ERROR: Queue is not known to be sorted, call sort "
+                          "first");
                 ok = false;
-                break;
+            } else {
+                fail_count++;
+                if (fail_count < fail_limit)
+                    report(2, "Insertion of %s failed", inserts);
+                else {
+                    report(1,
+                           "ERROR: Insertion of %s failed (%d failures total)",
+                           inserts, fail_count);
+                    ok = false;
+                }
             }
+            ok = ok && !error_check();
         }
     }
+    exception_cancel();
+    /* Time spent making random strings left out */
+    report_bench("Inserted", reps, cmps, elapsed);
+    report_counters("is", elapsed);
+
+    if (ok && current && current->q)
+        ok = check_sorted(current->q, q_size(current->q), ORDER_ASC);
 
     q_show(3);
-    return ok && !error_check();
+    return ok;
 }
 
 /*-------------------------------------shuffle------------------------------------------*/
@@ -708,8 +1055,11 @@ bool do_shuffle(int argc, char *argv[])
     error_check();
 
     set_noallocate_mode(true);
-    if (current && exception_setup(true))
+    if (current && exception_setup(true)) {
+        q_straighten(current->q);
         shuffle(current->q);
+        q_relinked(current->q, false);
+    }
     exception_cancel();
 
     set_noallocate_mode(false);
@@ -721,15 +1071,6 @@ bool do_shuffle(int argc, char *argv[])
 
 
 /*-------------------------------------list_sort------------------------------------------*/
-int cmp(void *priv,
-        const struct list_head *list1,
-        const struct list_head *list2)
-{
-    element_t *list1_entry = list_entry(list1, element_t, list);
-    element_t *list2_entry = list_entry(list2, element_t, list);
-    return strcmp(list1_entry->value, list2_entry->value);
-}
-
 bool do_list_sort(int argc, char *argv[])
 {
     if (argc != 1) {
@@ -748,18 +1089,87 @@ bool do_list_sort(int argc, char *argv[])
         report(3, "Warning: Calling sort on single node");
     error_check();
 
+    double start;
+    init_time(&start);
+    list_sort_cmps = 0;
+    q_key_ties = 0;
+    reset_counters();
     set_noallocate_mode(true);
-    if (current && exception_setup(true))
-        list_sort(NULL, current->q, cmp);
+    if (current && exception_setup(true)) {
+        q_straighten(current->q);
+        if (lsort_generic && lsort_gallop)
+            list_sort_gallop(NULL, current->q, orders[sort_order].cmp);
+        else if (lsort_generic)
+            list_sort(NULL, current->q, orders[sort_order].cmp);
+        else
+            orders[sort_order].sort(&list_sort_cmps, current->q);
+        q_relinked(current->q, sort_order == ORDER_ASC);
+    }
     exception_cancel();
     set_noallocate_mode(false);
+    double elapsed = delta_time(&start);
+    report_bench("Sorted", cnt, list_sort_cmps, elapsed);
+    report_counters("list_sort", elapsed);
 
     bool ok = true;
-    if (current && current->size) {
+    if (current && current->size)
+        ok = check_sorted(current->q, cnt, sort_order);
+
+    q_show(3);
+    return ok && !error_check();
+}
+/*-------------------------------------list_sort------------------------------------------*/
+
+static bool do_sort_external(int argc, char *argv[])
+{
+    if (argc != 2) {
+        report(1, "%s needs 1 argument", argv[0]);
+        return false;
+    }
+
+    int budget;
+    if (!get_int(argv[1], &budget) || budget < Q_EXT_MIN_BUDGET) {
+        report(1, "Invalid budget '%s', at least %d bytes", argv[1],
+               Q_EXT_MIN_BUDGET);
+        return false;
+    }
+
+    if (!current || !current->q) {
+        report(3, "Warning: Calling sort on null queue");
+        return !error_check();
+    }
+
+    int cnt = q_size(current->q);
+    struct q_ext_stats stats;
+    bool ok = false;
+
+    /* Every element is released and allocated again */
+    if (cnt > BIG_LIST_SIZE)
+        set_cautious_mode(false);
+    /* Bound by disk I/O rather than by the code, so no time limit */
+    if (exception_setup(false))
+        ok = q_sort_external(current->q, budget, &stats);
+    exception_cancel();
+    set_cautious_mode(true);
+
+    if (!ok)
+        report(1, "ERROR: External sort failed");
+    current->size = q_size(current->q);
+    if (ok && current->size != cnt) {
+        report(1, "ERROR: Sorted queue has %d elements, expected %d",
+               current->size, cnt);
+        ok = false;
+    }
+
+    report(1,
+           "Spilled %zu bytes in %zu runs, %zu merges, peak memory %zu bytes",
+           stats.spilled, stats.runs, stats.merges, stats.peak);
+    report(1, "Runs: %.3f s, merge: %.3f s", stats.run_time,
+           stats.merge_time);
+
+    if (current->size) {
         for (struct list_head *cur_l = current->q->next;
-             cur_l != current->q && --cnt; cur_l = cur_l->next) {
-            /* Ensure each element in ascending order */
-            /* FIXME: add an option to specify sorting order */
+             cur_l->next != current->q; cur_l = cur_l->next) {
             element_t *item, *next_item;
             item = list_entry(cur_l, element_t, list);
             next_item = list_entry(cur_l->next, element_t, list);
@@ -774,11 +1184,30 @@ bool do_list_sort(int argc, char *argv[])
     q_show(3);
     return ok && !error_check();
 }
-/*-------------------------------------list_sort------------------------------------------*/
 
 
 static bool do_dm(int argc, char *argv[])
 {
+    if (simulation) {
+        if (argc != 1) {
+            report(1, "%s does not need arguments in simulation mode", argv[0]);
+            return false;
+        }
+        /* free() would search a list of blocks that grows with the queue,
+         * timing the harness instead of q_delete_mid
+         */
+        set_cautious_mode(false);
+        bool ok = is_delete_mid_const();
+        set_cautious_mode(true);
+        if (!ok) {
+            report(1,
+                   "ERROR: Probably not constant time or wrong implementation");
+            return false;
+        }
+        report(1, "Probably constant time");
+        return ok;
+    }
+
     if (argc != 1) {
         report(1, "%s takes no arguments", argv[0]);
         return false;
@@ -790,10 +1219,15 @@ static bool do_dm(int argc, char *argv[])
     }
     error_check();
 
+    /* free() in cautious mode searches every block, swamping the O(1) delete */
+    if (current->size > BIG_LIST_SIZE)
+        set_cautious_mode(false);
+
     bool ok = true;
     if (exception_setup(true))
         ok = q_delete_mid(current->q);
     exception_cancel();
+    set_cautious_mode(true);
 
     if (!current->size)
         report(3, "Warning: Try to delete middle node to empty queue");
@@ -903,6 +1337,159 @@ static bool do_reverseK(int argc, char *argv[])
     return !error_check();
 }
 
+/* Parse the optional 'largest' and 'discard' words of topk and select */
+static bool get_pick_flags(int argc, char *argv[], int *flags)
+{
+    *flags = 0;
+    for (int i = 2; i < argc; i++) {
+        if (!strcmp(argv[i], "largest")) {
+            *flags |= Q_LARGEST;
+        } else if (!strcmp(argv[i], "discard")) {
+            *flags |= Q_DISCARD;
+        } else {
+            report(1, "Unknown flag '%s' for %s", argv[i], argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Compare two strings in the rank order selected by @flags */
+static int pick_cmp(const char *a, const char *b, int flags)
+{
+    int c = strcmp(a, b);
+    return flags & Q_LARGEST ? -c : c;
+}
+
+static bool do_topk(int argc, char *argv[])
+{
+    int k, flags;
+
+    if (argc < 2 || !get_int(argv[1], &k) || k < 0) {
+        report(1, "%s needs a count of at least 0", argv[0]);
+        return false;
+    }
+    if (!get_pick_flags(argc, argv, &flags))
+        return false;
+
+    if (!current || !current->q) {
+        report(3, "Warning: Calling topk on null queue");
+        return false;
+    }
+    error_check();
+
+    int cnt = current->size, picked = -1;
+    double elapsed;
+    init_time(&elapsed);
+    q_key_ties = 0;
+    if (exception_setup(true))
+        picked = q_topk(current->q, k, flags);
+    exception_cancel();
+    report_bench("Selected", cnt, q_sort_cmps, delta_time(&elapsed));
+
+    if (picked < 0) {
+        report(1, "ERROR: Could not allocate the heap");
+        return false;
+    }
+    current->size = q_size(current->q);
+
+    bool ok = true;
+    int want = k < cnt ? k : cnt;
+    if (picked != want ||
+        current->size != ((flags & Q_DISCARD) ? want : cnt)) {
+        report(1, "ERROR: Picked %d of %d elements, expected %d", picked,
+               current->size, want);
+        ok = false;
+    }
+
+    /* The picked strings are in order and rank before all the others */
+    const char *last = NULL;
+    int i = 0;
+    element_t *item;
+    list_for_each_entry (item, current->q, list) {
+        if (last && ok && pick_cmp(last, item->value, flags) > 0) {
+            report(1, "ERROR: Element %d is out of rank order", i);
+            ok = false;
+        }
+        if (i++ < picked)
+            last = item->value;
+    }
+
+    q_show(3);
+    return ok && !error_check();
+}
+
+static bool do_select(int argc, char *argv[])
+{
+    int rank, flags;
+
+    if (argc < 2 || !get_int(argv[1], &rank) || rank < 0) {
+        report(1, "%s needs a rank of at least 0", argv[0]);
+        return false;
+    }
+    if (!get_pick_flags(argc, argv, &flags))
+        return false;
+
+    if (!current || !current->q) {
+        report(3, "Warning: Calling select on null queue");
+        return false;
+    }
+    error_check();
+
+    if (rank >= current->size) {
+        report(1, "Rank %d is out of a queue of %d elements", rank,
+               current->size);
+        return false;
+    }
+
+    int cnt = current->size;
+    element_t *picked = NULL;
+    double elapsed;
+    init_time(&elapsed);
+    q_key_ties = 0;
+    if (exception_setup(true))
+        picked = q_select(current->q, rank, flags);
+    exception_cancel();
+    report_bench("Selected", cnt, q_sort_cmps, delta_time(&elapsed));
+
+    if (!picked) {
+        report(1, "ERROR: Could not allocate the array");
+        return false;
+    }
+    current->size = q_size(current->q);
+
+    bool ok = true;
+    if (flags & Q_DISCARD) {
+        if (current->size != 1 || current->q->next != &picked->list) {
+            report(1, "ERROR: Queue should only hold the picked element");
+            ok = false;
+        }
+    } else {
+        /* The rank of the string must be within its run of equal strings */
+        int before = 0, equal = 0;
+        element_t *item;
+        list_for_each_entry (item, current->q, list) {
+            int c = pick_cmp(item->value, picked->value, flags);
+            before += c < 0;
+            equal += c == 0;
+        }
+        if (rank < before || rank >= before + equal) {
+            report(1, "ERROR: Picked a string of rank %d..%d, expected %d",
+                   before, before + equal - 1, rank);
+            ok = false;
+        }
+    }
+
+    if (ok) {
+        char *str = picked->value;
+        report(1, "Selected %s",
+               strlen(str) > (size_t) string_length ? "<string>" : str);
+    }
+
+    q_show(3);
+    return ok && !error_check();
+}
+
 static bool do_merge(int argc, char *argv[])
 {
     if (argc != 1) {
@@ -917,13 +1504,21 @@ static bool do_merge(int argc, char *argv[])
     error_check();
 
     int len = 0;
+    double start;
+    init_time(&start);
+    q_sort_cmps = 0;
+    q_key_ties = 0;
+    reset_counters();
     set_noallocate_mode(true);
     if (current && exception_setup(true))
         len = q_merge(&chain.head);
     exception_cancel();
     set_noallocate_mode(false);
+    double elapsed = delta_time(&start);
+    report_bench("Merged", len, q_sort_cmps, elapsed);
+    report_counters("merge", elapsed);
 
-    if (q_size(&chain.head) > 1) {
+    if (chain.size > 1) {
         chain.size = 1;
         current = list_entry(chain.head.next, queue_contex_t, chain);
         current->size = len;
@@ -963,37 +1558,63 @@ static bool do_merge(int argc, char *argv[])
     return ok && !error_check();
 }
 
+/* Walk the next and prev links in the same loop, so that the two chains of
+ * loads overlap instead of taking a cache miss per node twice over
+ */
 static bool is_circular()
 {
-    struct list_head *cur = current->q->next;
-    while (cur != current->q) {
-        if (!cur)
-            return false;
-        cur = cur->next;
-    }
+    struct list_head *head = current->q;
+    struct list_head *fwd = head->next, *bwd = head->prev;
 
-    cur = current->q->prev;
-    while (cur != current->q) {
-        if (!cur)
+    while (fwd != head || bwd != head) {
+        if (!fwd || !bwd)
             return false;
-        cur = cur->prev;
+        if (fwd != head)
+            fwd = fwd->next;
+        if (bwd != head)
+            bwd = bwd->prev;
     }
     return true;
 }
 
+/* Where 'show' is in the queue it prints at verbosity @vlevel */
+struct show_state {
+    int vlevel;
+    int cnt;
+    bool ok;
+};
+
+/* Print element @e as 'show' does, for q_walk() too */
+static bool show_element(element_t *e, void *arg)
+{
+    struct show_state *st = arg;
+
+    if (st->cnt < BIG_LIST_SIZE) {
+        report_noreturn(st->vlevel, st->cnt == 0 ? "%s" : " %s", e->value);
+        if (show_entropy) {
+            report_noreturn(st->vlevel, "(%3.2f%%)",
+                            shannon_entropy((const uint8_t *) e->value));
+        }
+    }
+    st->cnt++;
+    st->ok = !error_check();
+    return st->ok;
+}
+
 static bool q_show(int vlevel)
 {
     bool ok = true;
     if (verblevel < vlevel)
         return true;
 
-    int cnt = 0;
     if (!current || !current->q) {
         report(vlevel, "l = NULL");
         return true;
     }
 
-    if (!is_circular()) {
+    /* The list of a chunked queue is not linked, its chunks are read */
+    bool linked = q_linked(current->q);
+    if (linked && !is_circular()) {
         report(vlevel, "ERROR:  Queue is not doubly circular");
         return false;
     }
@@ -1001,33 +1622,37 @@ static bool q_show(int vlevel)
     report_noreturn(vlevel, "l = [");
 
     struct list_head *ori = current->q;
-    struct list_head *cur = current->q->next;
+    struct list_head *cur = q_first(ori);
+    /* The queue was just found circular, so the cursor cannot hit NULL.  It
+     * only runs forward, so a reversed queue is shown without it, as is a
+     * chunked one read from its chunks.
+     */
+    struct list_head *ahead = q_reversed(ori) || !linked
+                                  ? ori
+                                  : list_prefetch_ahead(cur, ori);
+    struct show_state st = {vlevel, 0, true};
 
     if (exception_setup(true)) {
-        while (ok && ori != cur && cnt < current->size) {
-            element_t *e = list_entry(cur, element_t, list);
-            if (cnt < BIG_LIST_SIZE) {
-                report_noreturn(vlevel, cnt == 0 ? "%s" : " %s", e->value);
-                if (show_entropy) {
-                    report_noreturn(
-                        vlevel, "(%3.2f%%)",
-                        shannon_entropy((const uint8_t *) e->value));
-                }
+        if (linked) {
+            while (st.ok && ori != cur && st.cnt < current->size) {
+                show_element(list_entry(cur, element_t, list), &st);
+                cur = q_next(ori, cur);
+                ahead = element_prefetch_next(ahead, ori);
             }
-            cnt++;
-            cur = cur->next;
-            ok = ok && !error_check();
+        } else {
+            q_walk(ori, show_element, &st);
         }
     }
     exception_cancel();
+    ok = st.ok;
 
     if (!ok) {
         report(vlevel, " ... ]");
         return false;
     }
 
-    if (cur == ori) {
-        if (cnt <= BIG_LIST_SIZE)
+    if (linked ? cur == ori : st.cnt == current->size) {
+        if (st.cnt <= BIG_LIST_SIZE)
             report(vlevel, "]");
         else
             report(vlevel, " ... ]");
@@ -1054,6 +1679,298 @@ static bool do_show(int argc, char *argv[])
     return q_show(0);
 }
 
+/*-------------------------------------fuzz------------------------------------------*/
+/* Operations fuzz searches the worst inputs of */
+enum { FUZZ_SORT, FUZZ_LIST_SORT, FUZZ_DEDUP, FUZZ_DESCEND };
+static const char *const fuzz_ops[] = {"sort", "list_sort", "dedup",
+                                       "descend", NULL};
+
+/* What fuzz maximizes: comparisons per element where the operation counts
+ * them, q_sort and list_sort, or time per element
+ */
+enum { FUZZ_BY_CMPS, FUZZ_BY_TIME };
+static const char *const fuzzby_labels[] = {"cmps", "time", NULL};
+static int fuzz_by = FUZZ_BY_CMPS;
+
+/* Worst inputs kept by fuzz and saved as traces */
+#define FUZZ_KEEP 3
+
+/* Timed runs of each input, the fastest one counts */
+#define FUZZ_REPEAT 3
+
+struct fuzz_worst {
+    struct fuzz_genome g;
+    double score;
+};
+
+/* The commands that check the queue @op left in @q: one 'rh' for each of its
+ * strings in order, then 'size' to find it empty.  Returns a string released
+ * with free(), or NULL if out of memory.
+ */
+static char *fuzz_checks(struct list_head *q)
+{
+    size_t len = sizeof("size");
+    element_t *e;
+    list_for_each_entry (e, q, list)
+        len += strlen(e->value) + sizeof("rh ");
+
+    char *checks = malloc(len), *p = checks;
+    if (!checks)
+        return NULL;
+    list_for_each_entry (e, q, list)
+        p += snprintf(p, len - (p - checks), "rh %s\n", e->value);
+    snprintf(p, len - (p - checks), "size");
+    return checks;
+}
+
+/* Run @op once on a new queue of the @n strings of @keys.  Returns the
+ * comparisons or nanoseconds per element, or a negative value if the result
+ * is wrong or the queue cannot be built.  If @checks is not NULL, it gets
+ * the fuzz_checks() of the result.
+ */
+static double fuzz_run(int op, char **keys, int n, bool by_cmps, char **checks)
+{
+    struct list_head *q = q_new();
+    if (!q)
+        return -1;
+    for (int i = 0; i < n; i++) {
+        if (!q_insert_tail(q, keys[i])) {
+            q_free(q);
+            return -1;
+        }
+    }
+    /* list_sort and fuzz_checks() walk the list */
+    q_straighten(q);
+
+    size_t cmps = 0;
+    bool ok = true;
+    double start;
+    init_time(&start);
+    set_noallocate_mode(op == FUZZ_SORT || op == FUZZ_LIST_SORT);
+    switch (op) {
+    case FUZZ_SORT:
+        q_sort(q);
+        cmps = q_sort_cmps;
+        break;
+    case FUZZ_LIST_SORT:
+        list_sort_cmps = 0;
+        orders[sort_order].sort(&list_sort_cmps, q);
+        cmps = list_sort_cmps;
+        break;
+    case FUZZ_DEDUP:
+        ok = q_delete_dup(q);
+        break;
+    default:
+        q_descend(q);
+    }
+    double elapsed = delta_time(&start);
+    set_noallocate_mode(false);
+
+    if (op == FUZZ_SORT)
+        ok = check_sorted(q, n, ORDER_ASC);
+    else if (op == FUZZ_LIST_SORT)
+        ok = check_sorted(q, n, sort_order);
+    if (ok && checks)
+        ok = (*checks = fuzz_checks(q)) != NULL;
+    q_free(q);
+
+    if (!ok)
+        return -1;
+    return by_cmps ? (double) cmps / n : elapsed * 1e9 / n;
+}
+
+/* Score of the input @g describes for @op, negative if @op failed on it.
+ * If @checks is not NULL, it gets the fuzz_checks() of the result.
+ */
+static double fuzz_score(int op,
+                         const struct fuzz_genome *g,
+                         bool by_cmps,
+                         char **checks)
+{
+    char **keys = fuzz_generate(g);
+    if (!keys) {
+        report(1, "INTERNAL ERROR.  Could not allocate space for fuzz input");
+        return -1;
+    }
+
+    double best = -1;
+    for (int i = 0; i < (by_cmps ? 1 : FUZZ_REPEAT); i++) {
+        double score = -1;
+        if (exception_setup(true))
+            score = fuzz_run(op, keys, g->size, by_cmps, i ? NULL : checks);
+        exception_cancel();
+        if (score < 0) {
+            best = -1;
+            break;
+        }
+        if (best < 0 || score < best)
+            best = score;
+    }
+    free(keys);
+    return best;
+}
+
+/* Keep @g among the @n worst of @worst, in decreasing order of score */
+static int fuzz_keep(struct fuzz_worst *worst,
+                     int n,
+                     const struct fuzz_genome *g,
+                     double score)
+{
+    /* The same input again, mutated back */
+    for (int i = 0; i < n; i++) {
+        if (worst[i].score == score)
+            return n;
+    }
+    if (n == FUZZ_KEEP && score <= worst[n - 1].score)
+        return n;
+
+    int i = n < FUZZ_KEEP ? n++ : n - 1;
+    for (; i > 0 && worst[i - 1].score < score; i--)
+        worst[i] = worst[i - 1];
+    worst[i].g = *g;
+    worst[i].score = score;
+    return n;
+}
+
+static bool do_fuzz(int argc, char *argv[])
+{
+    if (argc < 2 || argc > 5) {
+        report(1, "%s needs 1-4 arguments", argv[0]);
+        return false;
+    }
+
+    int op = 0;
+    while (fuzz_ops[op] && strcmp(argv[1], fuzz_ops[op]))
+        op++;
+    if (!fuzz_ops[op]) {
+        report(1,
+               "Unknown operation '%s', one of sort, list_sort, dedup or "
+               "descend",
+               argv[1]);
+        return false;
+    }
+
+    int rounds = 100, size = 1000;
+    if (argc > 2 && (!get_int(argv[2], &rounds) || rounds < 1)) {
+        report(1, "Invalid number of rounds '%s'", argv[2]);
+        return false;
+    }
+    if (argc > 3 && (!get_int(argv[3], &size) || size < 2)) {
+        report(1, "Invalid number of elements '%s', at least 2", argv[3]);
+        return false;
+    }
+    /* Not traces/ by default, where the pinned worst cases are tracked */
+    const char *dir = argc > 4 ? argv[4] : P_tmpdir;
+
+    /* dedup and descend compare each neighbour once, whatever the input */
+    bool by_cmps =
+        fuzz_by == FUZZ_BY_CMPS && (op == FUZZ_SORT || op == FUZZ_LIST_SORT);
+    const char *unit = by_cmps ? "comparisons/element" : "ns/element";
+
+    int old_probability = fail_probability;
+    fail_probability = 0;
+    if (size > BIG_LIST_SIZE)
+        set_cautious_mode(false);
+
+    struct fuzz_worst worst[FUZZ_KEEP];
+    int nworst = 0;
+    uint64_t rng = (uint64_t) rand() << 32 ^ rand();
+    bool ok = true;
+    char desc[256];
+
+    for (int r = 0; r < rounds; r++) {
+        struct fuzz_genome g;
+        if (r < FUZZ_KEEP) {
+            fuzz_init(&g, size, &rng);
+        } else {
+            g = worst[rand() % nworst].g;
+            fuzz_mutate(&g, &rng);
+        }
+
+        double score = fuzz_score(op, &g, by_cmps, NULL);
+        if (score < 0) {
+            /* Pin the input it failed on instead of the worst ones */
+            fuzz_describe(&g, desc, sizeof(desc));
+            report(1, "ERROR: %s failed on %s", fuzz_ops[op], desc);
+            worst[0].g = g;
+            worst[0].score = score;
+            nworst = 1;
+            ok = false;
+            break;
+        }
+        if (!nworst || score > worst[0].score) {
+            fuzz_describe(&g, desc, sizeof(desc));
+            report(2, "Round %d: %.2f %s, %s", r, score, unit, desc);
+        }
+        nworst = fuzz_keep(worst, nworst, &g, score);
+    }
+
+    /* Replay under the options the search ran with */
+    char opts[128] = "option fail 0\noption malloc 0\n";
+    size_t olen = strlen(opts);
+    if (op == FUZZ_SORT)
+        snprintf(opts + olen, sizeof(opts) - olen,
+                 "option bench 1\noption sortalgo %s",
+                 sortalgo_labels[q_sort_algo]);
+    else if (op == FUZZ_LIST_SORT)
+        snprintf(opts + olen, sizeof(opts) - olen,
+                 "option bench 1\noption order %s\noption gallop %d",
+                 order_labels[sort_order], lsort_gallop);
+    const char *run = op == FUZZ_SORT || op == FUZZ_LIST_SORT ? "" : "time ";
+
+    for (int i = 0; i < nworst; i++) {
+        char path[256], comment[512];
+        snprintf(path, sizeof(path), "%s/trace-fuzz-%s-%d.cmd", dir,
+                 fuzz_ops[op], i + 1);
+        fuzz_describe(&worst[i].g, desc, sizeof(desc));
+        if (worst[i].score < 0)
+            snprintf(comment, sizeof(comment),
+                     "Input %s failed on, found by 'fuzz %s %d %d'\n%s",
+                     fuzz_ops[op], fuzz_ops[op], rounds, size, desc);
+        else
+            snprintf(comment, sizeof(comment),
+                     "Worst case %d for %s found by 'fuzz %s %d %d': "
+                     "%.2f %s\n%s",
+                     i + 1, fuzz_ops[op], fuzz_ops[op], rounds, size,
+                     worst[i].score, unit, desc);
+
+        /* Run it once more to pin what it leaves, unless that is what failed */
+        char *checks = NULL;
+        if (worst[i].score >= 0 &&
+            fuzz_score(op, &worst[i].g, true, &checks) < 0) {
+            report(1, "ERROR: %s failed on %s", fuzz_ops[op], desc);
+            ok = false;
+        }
+        size_t clen = strlen(run) + strlen(fuzz_ops[op]) +
+                      (checks ? strlen(checks) : 0) + sizeof("\n\nfree");
+        char *cmds = malloc(clen);
+        if (!cmds) {
+            free(checks);
+            report(1, "Could not write %s", path);
+            ok = false;
+            continue;
+        }
+        snprintf(cmds, clen, "%s%s\n%s%sfree", run, fuzz_ops[op],
+                 checks ? checks : "", checks ? "\n" : "");
+        free(checks);
+
+        bool saved = fuzz_save(path, &worst[i].g, comment, opts, cmds);
+        free(cmds);
+        if (!saved) {
+            report(1, "Could not write %s", path);
+            ok = false;
+            continue;
+        }
+        report(1, "Saved %s: %.2f %s, %s", path, worst[i].score, unit, desc);
+    }
+
+    fail_probability = old_probability;
+    set_cautious_mode(true);
+
+    return ok && !error_check();
+}
+/*-------------------------------------fuzz------------------------------------------*/
+
 static bool do_prev(int argc, char *argv[])
 {
     if (argc != 1) {
@@ -1100,9 +2017,23 @@ static bool do_next(int argc, char *argv[])
     return q_show(0);
 }
 
+static void set_threads(int oldval)
+{
+    if (q_sort_threads < 1) {
+        report(1, "Thread count must be at least 1");
+        q_sort_threads = oldval;
+    }
+}
+
 static void console_init()
 {
-    ADD_COMMAND(new, "Create new queue", "");
+    ADD_COMMAND(new,
+                "Create new queue, its elements carved from slabs if storage "
+                "is slab, compact, ringindex or chunk, ringindex also keeping "
+                "an array of them, chunk holding them in chunks of pointers, "
+                "and sharing equal strings if intern (default: option pool "
+                "and option intern)",
+                "[storage] [intern]");
     ADD_COMMAND(free, "Delete queue", "");
     ADD_COMMAND(prev, "Switch to previous queue", "");
     ADD_COMMAND(next, "Switch to next queue", "");
@@ -1114,6 +2045,11 @@ static void console_init()
                 "Insert string str at tail of queue n times. Generate random "
                 "string(s) if str equals RAND. (default: n == 1)",
                 "str [n]");
+    ADD_COMMAND(is,
+                "Insert string str in ascending order n times into a sorted "
+                "queue. Generate random string(s) if str equals RAND. "
+                "(default: n == 1)",
+                "str [n]");
     ADD_COMMAND(
         rh,
         "Remove from head of queue. Optionally compare to expected value str",
@@ -1126,8 +2062,22 @@ static void console_init()
     ADD_COMMAND(shuffle, "Shuffle queue", "");
     ADD_COMMAND(sort, "Sort queue in ascending order by mysort", "");
     ADD_COMMAND(list_sort, "Sort queue in ascending order by list_sort", "");
+    ADD_COMMAND(sort_external,
+                "Sort queue in ascending order through temporary files, "
+                "using at most 'budget' bytes of memory",
+                "budget");
+    ADD_COMMAND(topk,
+                "Bring the k smallest strings to the front in order, or the "
+                "largest ones, optionally discarding the rest",
+                "k [largest] [discard]");
+    ADD_COMMAND(select,
+                "Find the string of rank i counted from 0, optionally "
+                "discarding every other one",
+                "i [largest] [discard]");
     ADD_COMMAND(size, "Compute queue size n times (default: n == 1)", "[n]");
     ADD_COMMAND(show, "Show queue contents", "");
+    ADD_COMMAND(mem, "Show memory held by queue, in total and per element",
+                "");
     ADD_COMMAND(dm, "Delete middle node in queue", "");
     ADD_COMMAND(dedup, "Delete all nodes that have duplicate string", "");
     ADD_COMMAND(merge, "Merge all the queues into one sorted queue", "");
@@ -1138,12 +2088,42 @@ static void console_init()
                 "");
     ADD_COMMAND(reverseK, "Reverse the nodes of the queue 'K' at a time",
                 "[K]");
+    ADD_COMMAND(fuzz,
+                "Search for the inputs of n elements that make op (sort, "
+                "list_sort, dedup or descend) do the most work and save them "
+                "as traces under dir (default: 100 rounds, n == 1000, "
+                "dir == " P_tmpdir ")",
+                "op [rounds] [n] [dir]");
     add_param("length", &string_length, "Maximum length of displayed string",
               NULL);
     add_param("malloc", &fail_probability, "Malloc failure probability percent",
               NULL);
     add_param("fail", &fail_limit,
               "Number of times allow queue operations to return false", NULL);
+    add_param("bench", &bench,
+              "Report comparisons and ns/element of sort commands", NULL);
+    add_param_labels("sortalgo", &q_sort_algo, "Sort engine used by q_sort",
+                     sortalgo_labels, NULL);
+    add_param_labels("pool", &q_pool_mode,
+                     "Storage of new queues: malloc, slab, compact, "
+                     "ringindex or chunk",
+                     pool_labels, NULL);
+    add_param("intern", &q_intern_mode,
+              "Share one copy of equal strings in new queues", NULL);
+    add_param_labels("order", &sort_order, "Order of list_sort", order_labels,
+                     NULL);
+    add_param("lsort_generic", &lsort_generic,
+              "Call the comparison of list_sort through a function pointer",
+              NULL);
+    add_param("gallop", &lsort_gallop,
+              "Merge in galloping mode in list_sort", NULL);
+    add_param("sortstats", &sortstats,
+              "Report the engine, time and sampling of each sort", NULL);
+    add_param("threads", &q_sort_threads,
+              "Maximum number of threads used by q_sort", set_threads);
+    add_param_labels("fuzzby", &fuzz_by,
+                     "What fuzz maximizes, comparisons or time per element",
+                     fuzzby_labels, NULL);
 }
 
 /* Signal handlers */
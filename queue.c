@@ -1,7 +1,12 @@
 #include "queue.h"
+#include <math.h>
+#include <pthread.h>
+#include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
 
 /* Notice: sometimes, Cppcheck would find the potential NULL pointer bugs,
  * but some of them cannot occur. You can suppress them by adding the
@@ -10,352 +15,3546 @@
  */
 
 
-/* Create an empty queue */
-struct list_head *q_new()
+int q_pool_mode = 0;
+int q_intern_mode = 0;
+__thread size_t q_sort_cmps = 0;
+__thread size_t q_key_ties = 0;
+#if Q_STATS
+__thread struct q_counters q_counters;
+#endif
+int q_sort_algo = Q_SORT_MERGE;
+int q_sort_threads = 1;
+struct q_sort_stats q_sort_stats;
+
+/* Monotonic time in seconds, for the statistics of the sorts */
+static double clock_now()
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Capacity of the first slab of a pool in ELEMENT_SMALL_SIZE elements,
+ * doubled up to the max
+ */
+#define POOL_SLAB_MIN 64
+#define POOL_SLAB_MAX 65536
+
+/* A compact pool carves elements of up to POOL_COMPACT_MAX bytes, each
+ * rounded up to POOL_ALIGN, and keeps a free list per size
+ */
+#define POOL_ALIGN 8
+#define POOL_COMPACT_MAX 256
+#define POOL_CLASSES (POOL_COMPACT_MAX / POOL_ALIGN + 1)
+
+struct q_slab {
+    struct q_slab *next;
+    char nodes[];
+};
+
+/**
+ * struct q_pool - Slab allocator for the small-string elements of a queue
+ * @slabs: every slab allocated so far, newest first
+ * @free_list: released elements by size / POOL_ALIGN, chained through
+ *             list.next
+ * @cursor: next never-used byte in the newest slab
+ * @end: end of the newest slab
+ * @slab_nodes: capacity of the next slab
+ * @slab_bytes: bytes taken by the slabs, as malloc_usage() counts them
+ * @live: elements handed out and not yet released
+ * @compact: elements take their own size, not ELEMENT_SMALL_SIZE
+ * @orphan: the owning queue has been freed
+ */
+struct q_pool {
+    struct q_slab *slabs;
+    struct list_head *free_list[POOL_CLASSES];
+    char *cursor, *end;
+    size_t slab_nodes;
+    size_t slab_bytes;
+    size_t live;
+    bool compact;
+    bool orphan;
+};
+
+/* Bytes glibc takes for a request of @size bytes, as it rounds it up to a
+ * chunk with its header.  The checks of the harness are not counted.
+ */
+static inline size_t malloc_usage(size_t size)
+{
+    size = (size + sizeof(size_t) + 15) & ~(size_t) 15;
+    return size < 32 ? 32 : size;
+}
+
+/* Start a new slab for @pool, twice as large as the last one up to the max */
+static bool pool_grow(struct q_pool *pool)
+{
+    size_t bytes = pool->slab_nodes * ELEMENT_SMALL_SIZE;
+    struct q_slab *slab = malloc(sizeof(struct q_slab) + bytes);
+
+    if (!slab)
+        return false;
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->slab_bytes += malloc_usage(sizeof(struct q_slab) + bytes);
+    pool->cursor = slab->nodes;
+    pool->end = slab->nodes + bytes;
+    if (pool->slab_nodes < POOL_SLAB_MAX)
+        pool->slab_nodes <<= 1;
+    return true;
+}
+
+/* The first slab comes with the pool, so that the first insert into the
+ * queue does not allocate more than the others
+ */
+static struct q_pool *pool_new(bool compact)
+{
+    struct q_pool *pool = malloc(sizeof(struct q_pool));
+
+    if (!pool)
+        return NULL;
+
+    pool->slabs = NULL;
+    memset(pool->free_list, 0, sizeof(pool->free_list));
+    pool->cursor = pool->end = NULL;
+    pool->slab_nodes = POOL_SLAB_MIN;
+    pool->slab_bytes = 0;
+    pool->live = 0;
+    pool->compact = compact;
+    pool->orphan = false;
+    if (!pool_grow(pool)) {
+        free(pool);
+        return NULL;
+    }
+
+    return pool;
+}
+
+/* Slot size in @pool of an element allocated with @size bytes, 0 if the
+ * pool does not take elements that large
+ */
+static inline size_t pool_slot(const struct q_pool *pool, size_t size)
+{
+    if (!pool->compact)
+        return size <= ELEMENT_SMALL_SIZE ? ELEMENT_SMALL_SIZE : 0;
+    return size <= POOL_COMPACT_MAX ? (size + POOL_ALIGN - 1) & -POOL_ALIGN
+                                    : 0;
+}
+
+static void pool_destroy(struct q_pool *pool)
+{
+    struct q_slab *slab = pool->slabs;
+
+    while (slab) {
+        struct q_slab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    free(pool);
+}
+
+/* Hand out one element in a slot of @slot bytes, preferring recycled ones */
+static element_t *pool_get(struct q_pool *pool, size_t slot)
+{
+    struct list_head **free_list = &pool->free_list[slot / POOL_ALIGN];
+    element_t *e;
+
+    if (*free_list) {
+        e = list_entry(*free_list, element_t, list);
+        *free_list = (*free_list)->next;
+    } else {
+        /* The end of a slab too short for this slot is left unused */
+        if (pool->end - pool->cursor < (ptrdiff_t) slot && !pool_grow(pool))
+            return NULL;
+        e = (element_t *) pool->cursor;
+        pool->cursor += slot;
+    }
+
+    e->pool = pool;
+    pool->live++;
+    return e;
+}
+
+/* Slots of a new intern table */
+#define INTERN_SLOTS_MIN 16
+
+/**
+ * struct q_istr - String of an intern table
+ * @table: the table the string is in
+ * @hash: hash of the string
+ * @refs: the number of elements pointing at @str
+ * @str: the string, which the elements take as their value
+ */
+struct q_istr {
+    struct q_intern *table;
+    uint32_t hash;
+    uint32_t refs;
+    char str[];
+};
+
+/**
+ * struct q_islot - Slot of an intern table
+ * @hash: hash of the string, so that probes and growing the table mostly
+ *        read slots
+ * @x: the string, NULL for a free slot
+ */
+struct q_islot {
+    uint32_t hash;
+    struct q_istr *x;
+};
+
+/**
+ * struct q_intern - Intern table of a queue, so that equal strings are
+ *                   stored once
+ * @slots: open-addressed slots probed linearly from hash & @mask
+ * @mask: the number of slots minus one, a power of two minus one
+ * @strings: strings in the table, at most three in four slots
+ * @refs: elements pointing at strings of the table
+ * @orphan: the owning queue has been freed
+ *
+ * A string is freed with the last element pointing at it, and an orphan
+ * table with its last string.
+ */
+struct q_intern {
+    struct q_islot *slots;
+    size_t mask;
+    size_t strings;
+    size_t refs;
+    bool orphan;
+};
+
+/* FNV-1a hash of the @len bytes of @s */
+static inline uint32_t intern_hash(const char *s, size_t len)
+{
+    uint32_t h = 2166136261u;
+
+    for (size_t i = 0; i < len; i++)
+        h = (h ^ (unsigned char) s[i]) * 16777619u;
+    return h;
+}
+
+/* Allocate @n free slots */
+static struct q_islot *intern_slots(size_t n)
+{
+    struct q_islot *slots = malloc(n * sizeof(*slots));
+
+    if (slots) {
+        for (size_t i = 0; i < n; i++)
+            slots[i].x = NULL;
+    }
+    return slots;
+}
+
+static struct q_intern *intern_new()
+{
+    struct q_intern *table = malloc(sizeof(struct q_intern));
+
+    if (!table)
+        return NULL;
+    table->slots = intern_slots(INTERN_SLOTS_MIN);
+    if (!table->slots) {
+        free(table);
+        return NULL;
+    }
+    table->mask = INTERN_SLOTS_MIN - 1;
+    table->strings = 0;
+    table->refs = 0;
+    table->orphan = false;
+
+    return table;
+}
+
+static void intern_destroy(struct q_intern *table)
+{
+    for (size_t i = 0; i <= table->mask; i++)
+        free(table->slots[i].x);
+    free(table->slots);
+    free(table);
+}
+
+/* Double the slots of @table, false without memory */
+static bool intern_grow(struct q_intern *table)
+{
+    size_t mask = table->mask * 2 + 1;
+    struct q_islot *slots = intern_slots(mask + 1);
+
+    if (!slots)
+        return false;
+    for (size_t i = 0; i <= table->mask; i++) {
+        if (!table->slots[i].x)
+            continue;
+        size_t j = table->slots[i].hash & mask;
+        while (slots[j].x)
+            j = (j + 1) & mask;
+        slots[j] = table->slots[i];
+    }
+    free(table->slots);
+    table->slots = slots;
+    table->mask = mask;
+    return true;
+}
+
+/* Take a reference on the copy of @s, of @len bytes with its terminator, in
+ * @table, adding one if there is none yet.  Returns the copy, NULL without
+ * memory.
+ */
+static char *intern_get(struct q_intern *table, const char *s, size_t len)
+{
+    uint32_t hash = intern_hash(s, len);
+    size_t i = hash & table->mask;
+    struct q_istr *x;
+
+    for (; (x = table->slots[i].x); i = (i + 1) & table->mask) {
+        if (table->slots[i].hash == hash && !strcmp(x->str, s))
+            break;
+    }
+    if (!x) {
+        /* Grown before a string takes the last free slot in four */
+        if (4 * (table->strings + 1) > 3 * (table->mask + 1)) {
+            if (!intern_grow(table))
+                return NULL;
+            for (i = hash & table->mask; table->slots[i].x;
+                 i = (i + 1) & table->mask)
+                ;
+        }
+        x = malloc(sizeof(struct q_istr) + len);
+        if (!x)
+            return NULL;
+        x->table = table;
+        x->hash = hash;
+        x->refs = 0;
+        memcpy(x->str, s, len);
+        table->slots[i].hash = hash;
+        table->slots[i].x = x;
+        table->strings++;
+    }
+    x->refs++;
+    table->refs++;
+    return x->str;
+}
+
+/* Drop a reference on interned string @str, freeing it with the last one */
+static void intern_put(char *str)
+{
+    struct q_istr *x =
+        (struct q_istr *) (str - offsetof(struct q_istr, str));
+    struct q_intern *table = x->table;
+    size_t mask = table->mask;
+
+    table->refs--;
+    if (--x->refs)
+        return;
+
+    size_t i = x->hash & mask;
+    while (table->slots[i].x != x)
+        i = (i + 1) & mask;
+
+    /* Move back each string after the gap that may not be probed past it */
+    for (size_t j = (i + 1) & mask; table->slots[j].x; j = (j + 1) & mask) {
+        size_t home = table->slots[j].hash & mask;
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            table->slots[i] = table->slots[j];
+            i = j;
+        }
+    }
+    table->slots[i].x = NULL;
+
+    free(x);
+    if (!--table->strings && table->orphan)
+        intern_destroy(table);
+}
+
+/* Recover the header of the queue whose list head is @head */
+static inline queue_t *q_of(struct list_head *head)
+{
+    return list_entry(head, queue_t, head);
+}
+
+/* Node before @node of queue @head in reading order */
+static inline struct list_head *q_prev(struct list_head *head,
+                                       struct list_head *node)
+{
+    return q_reversed(head) ? node->next : node->prev;
+}
+
+/* Move the middle node of queue @q, if known, to index size / 2 again after
+ * node @node was linked in at the head (@at_head) or the tail.  @q->size
+ * already counts @node.
+ */
+static inline void mid_after_insert(queue_t *q,
+                                    struct list_head *node,
+                                    bool at_head)
+{
+    if (q->size == 1)
+        q->mid = node;
+    else if (q->mid && at_head && (q->size & 1))
+        q->mid = q_prev(&q->head, q->mid);
+    else if (q->mid && !at_head && !(q->size & 1))
+        q->mid = q_next(&q->head, q->mid);
+}
+
+/* As mid_after_insert(), before the node at the head (@at_head) or the tail
+ * of @q is unlinked
+ */
+static inline void mid_before_remove(queue_t *q, bool at_head)
+{
+    if (q->size == 1)
+        q->mid = NULL;
+    else if (q->mid && at_head && (q->size & 1))
+        q->mid = q_next(&q->head, q->mid);
+    else if (q->mid && !at_head && !(q->size & 1))
+        q->mid = q_prev(&q->head, q->mid);
+}
+
+/* Keep @q->sorted only if @e, just linked in at one end of the list, is in
+ * order with the element next to it
+ */
+static inline void sorted_after_insert(queue_t *q, const element_t *e)
+{
+    struct list_head *prev = e->list.prev, *next = e->list.next;
+
+    if (!q->sorted)
+        return;
+    if (prev != &q->head)
+        q->sorted = element_cmp(list_entry(prev, element_t, list), e) <= 0;
+    else if (next != &q->head)
+        q->sorted = element_cmp(e, list_entry(next, element_t, list)) <= 0;
+}
+
+/* Account for element @e being linked into queue @q */
+static inline void q_account_add(queue_t *q, const element_t *e)
+{
+    q->size++;
+    q->bytes += strlen(e->value) + 1;
+    if (e->pool && e->pool == q->pool)
+        q->pooled++;
+}
+
+/* Account for element @e being unlinked from queue @q */
+static inline void q_account_del(queue_t *q, const element_t *e)
+{
+    q->size--;
+    q->bytes -= strlen(e->value) + 1;
+    if (e->pool && e->pool == q->pool)
+        q->pooled--;
+}
+
+/* Does element @e point at a string of an intern table? */
+static inline bool element_interned(const element_t *e)
+{
+    return e->value != e->data;
+}
+
+/* Bytes element_new() allocated for element @e, or carved for it from its
+ * pool
+ */
+static inline size_t element_size(const element_t *e)
+{
+    if (element_interned(e))
+        return e->pool ? pool_slot(e->pool, sizeof(element_t))
+                       : sizeof(element_t);
+
+    size_t size = sizeof(element_t) + strlen(e->value) + 1;
+
+    if (e->pool)
+        return pool_slot(e->pool, size);
+    return size < ELEMENT_SMALL_SIZE ? ELEMENT_SMALL_SIZE : size;
+}
+
+#if KEY_PACK
+/* Bits of a packed key that hold the code of the string */
+#define KEY_PACK_BITS 60
+
+/* Packed key of @s, see element_t.  Each byte takes an order-preserving,
+ * prefix-free code:
+ *
+ *   '\0'            00000
+ *   0x01 .. 0x60    00001 and 7 bits of c - 0x01
+ *   'a' .. 'z'      00010 .. 11011
+ *   0x7b .. 0xff    111 and 8 bits of c - 0x7b
+ *
+ * so that the codes of two strings compare as the strings do.
+ */
+static inline uint64_t key_pack(const char *s)
+{
+    uint64_t key = 0;
+    int bits = 0;
+
+    for (size_t n = 0;; n++) {
+        unsigned char c = s[n];
+        uint64_t code;
+        int width;
+
+        if (!c) {
+            code = 0;
+            width = 5;
+        } else if (c < 'a') {
+            code = 1 << 7 | (c - 0x01);
+            width = 12;
+        } else if (c <= 'z') {
+            code = c - 'a' + 2;
+            width = 5;
+        } else {
+            code = 7 << 8 | (c - 0x7b);
+            width = 11;
+        }
+
+        /* The leading bits of a code that does not fit still order it */
+        if (bits + width > KEY_PACK_BITS) {
+            int fit = KEY_PACK_BITS - bits;
+            key = key << fit | code >> (width - fit);
+            return key << 4 | n;
+        }
+        key = key << width | code;
+        bits += width;
+        if (!c)
+            return key << (KEY_PACK_BITS - bits) << 4 | 0xf;
+    }
+}
+#endif
+
+/* Allocate an element of queue @q holding a copy of @s in the same block, or
+ * pointing at the one in the intern table of @q
+ */
+static element_t *element_new(queue_t *q, const char *s)
 {
-    struct list_head *head =
-        (struct list_head *) malloc(sizeof(struct list_head));
+    size_t len = strlen(s) + 1;
+    char *str = NULL;
 
-    if (!head) {
-        free(head);
+    if (q->intern) {
+        str = intern_get(q->intern, s, len);
+        if (!str)
+            return NULL;
+    }
+
+    size_t size = sizeof(element_t) + (str ? 0 : len);
+    size_t slot = q->pool ? pool_slot(q->pool, size) : 0;
+    element_t *e;
+
+    /* Small-string fast path: carved from the slabs of the queue */
+    if (slot) {
+        e = pool_get(q->pool, slot);
+    } else {
+        e = malloc(size < ELEMENT_SMALL_SIZE && !str ? ELEMENT_SMALL_SIZE
+                                                     : size);
+        if (e)
+            e->pool = NULL;
+    }
+    if (!e) {
+        if (str)
+            intern_put(str);
         return NULL;
     }
 
-    INIT_LIST_HEAD(head);
+    e->value = str ? str : memcpy(e->data, s, len);
+#if KEY_PACK
+    e->key = key_pack(s);
+#elif KEY_PREFIX
+    e->key = 0;
+    for (size_t i = 0; i < sizeof(e->key); i++)
+        e->key = e->key << 8 | (i < len ? (unsigned char) s[i] : 0);
+#endif
+    return e;
+}
+
+/* Release the element */
+void q_release_element(element_t *e)
+{
+    struct q_pool *pool = e->pool;
+
+    if (element_interned(e))
+        intern_put(e->value);
+    if (!pool) {
+        free(e);
+        return;
+    }
+
+    struct list_head **free_list =
+        &pool->free_list[element_size(e) / POOL_ALIGN];
+    e->list.next = *free_list;
+    *free_list = &e->list;
+    if (!--pool->live && pool->orphan)
+        pool_destroy(pool);
+}
+
+/* Levels of the skip-list index above the list itself */
+#define SKIP_LEVELS 20
+/* One node of a level in SKIP_FANOUT is also in the level above */
+#define SKIP_FANOUT_LOG2 2
+
+/**
+ * struct q_skip - Node of the skip-list index of a queue
+ * @e: indexed element, NULL in the header
+ * @key: copy of the key prefix of @e, so that a search mostly reads nodes
+ * @height: levels the node is linked into, levels in use for the header
+ * @next: next node of each level, in list order
+ *
+ * The list itself is the bottom level, so most elements have no node and
+ * a search ends with a short walk along the list.
+ */
+struct q_skip {
+    element_t *e;
+#if KEY_PREFIX
+    uint64_t key;
+#endif
+    int height;
+    struct q_skip *next[];
+};
+
+static uint64_t skip_seed = 0x2545f4914f6cdd1dULL;
+
+/* Levels of a new node, 0 for all but one element in 1 << SKIP_FANOUT_LOG2 */
+static inline int skip_height()
+{
+    skip_seed ^= skip_seed << 13;
+    skip_seed ^= skip_seed >> 7;
+    skip_seed ^= skip_seed << 17;
+    return __builtin_ctzll(skip_seed | 1ULL << SKIP_LEVELS * SKIP_FANOUT_LOG2) /
+           SKIP_FANOUT_LOG2;
+}
+
+/* Compare the element of node @x with @e as element_cmp() does */
+static inline int skip_cmp(const struct q_skip *x, const element_t *e)
+{
+#if KEY_PREFIX
+    if (x->key != e->key)
+        return x->key < e->key ? -1 : 1;
+#endif
+    return element_cmp(x->e, e);
+}
+
+/* Free the nodes of the index of @q, keeping its header */
+static void skip_clear(queue_t *q)
+{
+    struct q_skip *node = q->index->next[0];
+
+    while (node) {
+        struct q_skip *next = node->next[0];
+        free(node);
+        node = next;
+    }
+    memset(q->index->next, 0, SKIP_LEVELS * sizeof(q->index->next[0]));
+    q->index->height = 0;
+}
+
+/* Give element @e, just linked into the list of @q, a node of random height
+ * after the nodes of @update.  Without memory the element is left out of the
+ * index, which only makes the walks along the list longer.
+ */
+static void skip_link(queue_t *q, element_t *e, struct q_skip **update)
+{
+    struct q_skip *index = q->index;
+    int height = skip_height();
+
+    if (!height)
+        return;
+    struct q_skip *node =
+        malloc(sizeof(*node) + height * sizeof(node->next[0]));
+    if (!node)
+        return;
+
+    node->e = e;
+#if KEY_PREFIX
+    node->key = e->key;
+#endif
+    node->height = height;
+    for (; index->height < height; index->height++)
+        update[index->height] = index;
+    for (int l = 0; l < height; l++) {
+        node->next[l] = update[l]->next[l];
+        update[l]->next[l] = node;
+    }
+}
+
+/* Index the sorted list of @q from scratch */
+static void skip_build(queue_t *q)
+{
+    if (!q->index) {
+        q->index = malloc(sizeof(struct q_skip) +
+                          SKIP_LEVELS * sizeof(q->index->next[0]));
+        if (!q->index)
+            return;
+        q->index->e = NULL;
+        q->index->next[0] = NULL;
+    }
+    skip_clear(q);
+
+    struct q_skip *tail[SKIP_LEVELS];
+    for (int l = 0; l < SKIP_LEVELS; l++)
+        tail[l] = q->index;
+
+    element_t *e;
+    list_for_each_entry (e, &q->head, list) {
+        skip_link(q, e, tail);
+        /* A new node is the last one of each of its levels */
+        for (int l = 0; l < SKIP_LEVELS && tail[l]->next[l]; l++)
+            tail[l] = tail[l]->next[l];
+    }
+    q->indexed = true;
+}
+
+/* Find where @e goes in the indexed list of @q, after every element less than
+ * or equal to it.  Returns the node to link @e after, and the last node of
+ * each level before that point in @update.
+ */
+static struct list_head *skip_find(queue_t *q,
+                                   const element_t *e,
+                                   struct q_skip **update)
+{
+    struct q_skip *x = q->index;
+
+    for (int l = q->index->height - 1; l >= 0; l--) {
+        while (x->next[l] && (q_sort_cmps++, Q_COUNT(cmps, 1),
+                              skip_cmp(x->next[l], e) <= 0))
+            x = x->next[l];
+        update[l] = x;
+    }
+
+    struct list_head *pos = x->e ? &x->e->list : &q->head;
+    while (pos->next != &q->head &&
+           (q_sort_cmps++, Q_COUNT(cmps, 1),
+            element_cmp(list_entry(pos->next, element_t, list), e) <= 0))
+        pos = pos->next;
+    return pos;
+}
+
+/* Fill @update with the last node of each level before the node of @e, the
+ * last element of the list of @q or one not indexed yet.  Returns the node of
+ * @e, NULL if it has none.
+ */
+static struct q_skip *skip_last(queue_t *q,
+                                const element_t *e,
+                                struct q_skip **update)
+{
+    struct q_skip *x = q->index;
+
+    for (int l = q->index->height - 1; l >= 0; l--) {
+        while (x->next[l] && x->next[l]->e != e)
+            x = x->next[l];
+        update[l] = x;
+    }
+    return q->index->height ? update[0]->next[0] : NULL;
+}
+
+/* Index element @e, just linked in at the head (@at_head) or the tail of the
+ * list of @q, or drop the index if it broke the order of the list
+ */
+static void skip_after_insert(queue_t *q, element_t *e, bool at_head)
+{
+    struct q_skip *update[SKIP_LEVELS];
+
+    if (!q->sorted) {
+        q->indexed = false;
+        return;
+    }
+    if (at_head) {
+        for (int l = 0; l < q->index->height; l++)
+            update[l] = q->index;
+    } else {
+        skip_last(q, e, update);
+    }
+    skip_link(q, e, update);
+}
+
+/* Unlink the node of @e, about to be removed from the head (@at_head) or the
+ * tail of the list of @q, from the index
+ */
+static void skip_before_remove(queue_t *q, const element_t *e, bool at_head)
+{
+    struct q_skip *update[SKIP_LEVELS], *node;
+
+    if (at_head) {
+        node = q->index->next[0];
+        for (int l = 0; l < q->index->height; l++)
+            update[l] = q->index;
+    } else {
+        node = skip_last(q, e, update);
+    }
+    if (!node || node->e != e)
+        return;
+
+    for (int l = 0; l < node->height; l++)
+        update[l]->next[l] = node->next[l];
+    free(node);
+}
+
+/* Slots of the smallest ring */
+#define RING_MIN 16
+/* Runs of the ring sort up to this length are sorted by insertion */
+#define RING_INSERTION_MAX 16
+
+/**
+ * struct q_slot - Slot of the ring of a queue
+ * @e: element
+ * @key: copy of the key prefix of @e, so that the sort mostly reads slots
+ */
+struct q_slot {
+    element_t *e;
+#if KEY_PREFIX
+    uint64_t key;
+#endif
+};
+
+/**
+ * struct q_ring - Ring index of a queue, its elements in list order
+ * @slots: power-of-two array of @cap slots
+ * @cap: the number of slots, zero until the first insert
+ * @first: slot of the first element of the list
+ *
+ * The elements sit in slots @first to @first + size - 1, modulo @cap.
+ */
+struct q_ring {
+    struct q_slot *slots;
+    size_t cap;
+    size_t first;
+};
+
+/* Compare the elements of slots @a and @b, counting the comparison */
+static inline int slot_cmp(const struct q_slot *a, const struct q_slot *b)
+{
+    q_sort_cmps++;
+    Q_COUNT(cmps, 1);
+#if KEY_PREFIX
+    if (a->key != b->key)
+        return a->key < b->key ? -1 : 1;
+#endif
+    return element_cmp(a->e, b->e);
+}
+
+/* Point @slot at element @e */
+static inline void slot_set(struct q_slot *slot, element_t *e)
+{
+    slot->e = e;
+#if KEY_PREFIX
+    slot->key = e->key;
+#endif
+}
+
+/* Double the ring of @q until it has two slots per element, copying the
+ * elements over if it is up to date.  The slots past the elements are the
+ * buffer of ring_sort(), which runs where allocating is not allowed.
+ * Without memory the ring is left stale.
+ */
+static bool ring_grow(queue_t *q, size_t n)
+{
+    struct q_ring *ring = q->ring;
+    size_t cap = ring->cap ? ring->cap : RING_MIN;
+
+    while (cap < 2 * (size_t) q->size)
+        cap *= 2;
+    struct q_slot *slots = malloc(cap * sizeof(*slots));
+    if (!slots) {
+        q->ringed = false;
+        return false;
+    }
+
+    /* The @n elements before the one being linked in */
+    if (q->ringed) {
+        size_t mask = ring->cap - 1;
+        for (size_t i = 0; i < n; i++)
+            slots[i] = ring->slots[(ring->first + i) & mask];
+        ring->first = 0;
+    }
+    free(ring->slots);
+    ring->slots = slots;
+    ring->cap = cap;
+    return true;
+}
+
+/* Give element @e, just linked in at the head (@at_head) or the tail of the
+ * list of @q, its slot in the ring.  @q->size already counts @e.
+ */
+static void ring_after_insert(queue_t *q, element_t *e, bool at_head)
+{
+    struct q_ring *ring = q->ring;
+
+    /* Any ring mirrors an empty list */
+    if (q->size == 1) {
+        ring->first = 0;
+        q->ringed = true;
+    }
+    if (2 * (size_t) q->size > ring->cap && !ring_grow(q, q->size - 1))
+        return;
+    if (!q->ringed)
+        return;
+
+    size_t mask = ring->cap - 1;
+    if (at_head)
+        ring->first = (ring->first - 1) & mask;
+    slot_set(&ring->slots[at_head ? ring->first
+                                  : (ring->first + q->size - 1) & mask],
+             e);
+}
+
+/* Drop the slot of the element about to be removed from the head (@at_head)
+ * or the tail of the list of @q
+ */
+static inline void ring_before_remove(queue_t *q, bool at_head)
+{
+    if (at_head)
+        q->ring->first = (q->ring->first + 1) & (q->ring->cap - 1);
+}
+
+/* Move the elements of the ring of @q to slots 0 to size - 1, reading them
+ * from the list if the ring is stale.  Fails if the ring is missing or has
+ * less than two slots per element, as after a q_merge() into the queue.
+ */
+static bool ring_ready(queue_t *q)
+{
+    struct q_ring *ring = q->ring;
+    size_t n = q->size;
+
+    if (!ring || ring->cap < 2 * n)
+        return false;
+
+    if (!q->ringed) {
+        element_t *e;
+        size_t i = 0;
+        list_for_each_entry (e, &q->head, list)
+            slot_set(&ring->slots[i++], e);
+    } else if (ring->cap - ring->first >= n) {
+        memmove(ring->slots, ring->slots + ring->first,
+                n * sizeof(ring->slots[0]));
+    } else {
+        /* Wrapped around: the part at the start of the array moves up past
+         * where the other part goes, which the free half of the ring keeps
+         * below the other part
+         */
+        size_t upper = ring->cap - ring->first;
+        memmove(ring->slots + upper, ring->slots,
+                (n - upper) * sizeof(ring->slots[0]));
+        memcpy(ring->slots, ring->slots + ring->first,
+               upper * sizeof(ring->slots[0]));
+    }
+    ring->first = 0;
+    q->ringed = true;
+    return true;
+}
+
+/* Link the list of @q in the order of its ring, after ring_ready() */
+static void ring_relink(queue_t *q)
+{
+    struct list_head *prev = &q->head;
+    struct q_slot *slots = q->ring->slots;
+
+    for (int i = 0; i < q->size; i++) {
+        struct list_head *node = &slots[i].e->list;
+        prev->next = node;
+        node->prev = prev;
+        prev = node;
+    }
+    prev->next = &q->head;
+    q->head.prev = prev;
+    Q_COUNT(writes, 2 * (q->size + 1));
+}
+
+/* Stable merge sort of the @n slots @a, with room for n / 2 slots at @buf */
+static void ring_merge_sort(struct q_slot *a, size_t n, struct q_slot *buf)
+{
+    if (n <= RING_INSERTION_MAX) {
+        for (size_t i = 1; i < n; i++) {
+            struct q_slot x = a[i];
+            size_t j = i;
+            for (; j && slot_cmp(&a[j - 1], &x) > 0; j--)
+                a[j] = a[j - 1];
+            a[j] = x;
+        }
+        return;
+    }
+
+    size_t half = n / 2;
+    ring_merge_sort(a, half, buf);
+    ring_merge_sort(a + half, n - half, buf);
+    /* Runs already in order are left as they are */
+    if (slot_cmp(&a[half - 1], &a[half]) <= 0)
+        return;
+
+    size_t i = 0, j = half, k = 0;
+    memcpy(buf, a, half * sizeof(*a));
+    while (i < half && j < n)
+        a[k++] = slot_cmp(&a[j], &buf[i]) < 0 ? a[j++] : buf[i++];
+    while (i < half)
+        a[k++] = buf[i++];
+}
+
+/* Element pointers in each chunk of a chunked queue */
+#define CHUNK_SLOTS 64
+
+/**
+ * struct q_chunk - Chunk of the storage of a chunked queue
+ * @node: link in the list of chunks
+ * @first: slot of the first element of the chunk
+ * @last: slot past the last element of the chunk
+ * @slots: the elements, in list order
+ */
+struct q_chunk {
+    struct list_head node;
+    int first;
+    int last;
+    element_t *slots[CHUNK_SLOTS];
+};
+
+/**
+ * struct q_chunks - Chunks of a chunked queue
+ * @list: the chunks in list order, none of them empty while up to date
+ * @spare: chunk for the next insert to take, allocated with the queue or
+ *         emptied by a remove, NULL if none
+ * @count: the number of chunks in @list
+ */
+struct q_chunks {
+    struct list_head list;
+    struct q_chunk *spare;
+    size_t count;
+};
+
+/* Link a new chunk in at the front (@front) or the back of @chunks, with all
+ * of its slots free on the side it grows to, or half of them on each side if
+ * it is the only one.  NULL without memory.
+ */
+static struct q_chunk *chunk_add(struct q_chunks *chunks, bool front)
+{
+    struct q_chunk *chunk = chunks->spare;
+
+    if (chunk)
+        chunks->spare = NULL;
+    else if (!(chunk = malloc(sizeof(struct q_chunk))))
+        return NULL;
+
+    if (list_empty(&chunks->list))
+        chunk->first = chunk->last = CHUNK_SLOTS / 2;
+    else
+        chunk->first = chunk->last = front ? CHUNK_SLOTS : 0;
+    if (front)
+        list_add(&chunk->node, &chunks->list);
+    else
+        list_add_tail(&chunk->node, &chunks->list);
+    chunks->count++;
+    return chunk;
+}
+
+/* Unlink @chunk from @chunks, keeping it as the spare if there is none */
+static void chunk_del(struct q_chunks *chunks, struct q_chunk *chunk)
+{
+    list_del(&chunk->node);
+    chunks->count--;
+    if (chunks->spare)
+        free(chunk);
+    else
+        chunks->spare = chunk;
+}
+
+/* Free @chunks with every chunk in it */
+static void chunk_destroy(struct q_chunks *chunks)
+{
+    struct q_chunk *chunk, *safe;
+
+    list_for_each_entry_safe (chunk, safe, &chunks->list, node)
+        free(chunk);
+    free(chunks->spare);
+    free(chunks);
+}
+
+/* Read the list of @q into its chunks, reusing the stale ones.  Without
+ * memory for a chunk @q stays on its list.
+ */
+static bool chunk_build(queue_t *q)
+{
+    struct q_chunks *chunks = q->chunks;
+    struct list_head *pos = &chunks->list;
+    struct q_chunk *chunk = NULL;
+    element_t *e;
+
+    list_for_each_entry (e, &q->head, list) {
+        if (!chunk || chunk->last == CHUNK_SLOTS) {
+            if (pos->next != &chunks->list) {
+                pos = pos->next;
+                chunk = list_entry(pos, struct q_chunk, node);
+            } else if ((chunk = chunk_add(chunks, false))) {
+                pos = &chunk->node;
+            } else {
+                return false;
+            }
+            chunk->first = chunk->last = 0;
+        }
+        chunk->slots[chunk->last++] = e;
+    }
+    while (pos->next != &chunks->list)
+        chunk_del(chunks, list_entry(pos->next, struct q_chunk, node));
+    q->chunked = true;
+    return true;
+}
+
+/* Link the list of @q in the order of its chunks, which stay up to date */
+static void chunk_link(queue_t *q)
+{
+    if (q->linked)
+        return;
+
+    struct list_head *prev = &q->head;
+    struct q_chunk *chunk;
+
+    list_for_each_entry (chunk, &q->chunks->list, node) {
+        for (int i = chunk->first; i < chunk->last; i++) {
+            struct list_head *node = &chunk->slots[i]->list;
+            prev->next = node;
+            node->prev = prev;
+            prev = node;
+        }
+    }
+    prev->next = &q->head;
+    q->head.prev = prev;
+    Q_COUNT(writes, 2 * (q->size + 1));
+    q->linked = true;
+}
+
+/* Leave @q on its list alone, for an operation that relinks or walks it.
+ * The chunks go stale but are kept, since some of these operations run where
+ * freeing is not allowed.
+ */
+static void q_link(queue_t *q)
+{
+    if (!q->chunked)
+        return;
+
+    chunk_link(q);
+    q->chunked = false;
+}
+
+/* Point @q->head at the first and the last element of the chunks of @q, as
+ * it does while the list is not linked
+ */
+static inline void chunk_ends(queue_t *q)
+{
+    struct q_chunk *first = list_first_entry(&q->chunks->list, struct q_chunk,
+                                             node);
+    struct q_chunk *last = list_last_entry(&q->chunks->list, struct q_chunk,
+                                           node);
+
+    q->head.next = &first->slots[first->first]->list;
+    q->head.prev = &last->slots[last->last - 1]->list;
+}
+
+/* Store element @e at the front (@front) or the back of the chunks of @q,
+ * reading the list into them first if they are stale.  Fails without memory,
+ * leaving @q on its list for the caller to link @e into.
+ */
+static bool chunk_push(queue_t *q, element_t *e, bool front)
+{
+    struct q_chunks *chunks = q->chunks;
+
+    if (!q->chunked && !chunk_build(q))
+        return false;
+
+    struct q_chunk *chunk = NULL;
+    if (!list_empty(&chunks->list)) {
+        chunk = front ? list_first_entry(&chunks->list, struct q_chunk, node)
+                      : list_last_entry(&chunks->list, struct q_chunk, node);
+        if (front ? !chunk->first : chunk->last == CHUNK_SLOTS)
+            chunk = NULL;
+    }
+    if (!chunk && !(chunk = chunk_add(chunks, front))) {
+        q_link(q);
+        return false;
+    }
+
+    /* In order with the element it goes next to */
+    if (q->sorted && q->size)
+        q->sorted = front ? element_cmp(e, list_entry(q->head.next, element_t,
+                                                      list)) <= 0
+                          : element_cmp(list_entry(q->head.prev, element_t,
+                                                   list),
+                                        e) <= 0;
+    if (front)
+        chunk->slots[--chunk->first] = e;
+    else
+        chunk->slots[chunk->last++] = e;
+    q_account_add(q, e);
+    chunk_ends(q);
+    q->linked = false;
+    q->mid = NULL;
+    q->indexed = false;
+    return true;
+}
+
+/* Take the element at the front (@front) or the back of the chunks of @q,
+ * which has some
+ */
+static element_t *chunk_pop(queue_t *q, bool front)
+{
+    struct q_chunks *chunks = q->chunks;
+    struct q_chunk *chunk =
+        front ? list_first_entry(&chunks->list, struct q_chunk, node)
+              : list_last_entry(&chunks->list, struct q_chunk, node);
+    element_t *e =
+        front ? chunk->slots[chunk->first++] : chunk->slots[--chunk->last];
+
+    if (chunk->first == chunk->last)
+        chunk_del(chunks, chunk);
+    q_account_del(q, e);
+    if (q->size) {
+        chunk_ends(q);
+        q->linked = false;
+    } else {
+        INIT_LIST_HEAD(&q->head);
+        q->linked = true;
+    }
+    q->mid = NULL;
+    q->indexed = false;
+    INIT_LIST_HEAD(&e->list);
+    return e;
+}
+
+/* Create an empty queue */
+struct list_head *q_new()
+{
+    queue_t *q = malloc(sizeof(queue_t));
+
+    if (!q)
+        return NULL;
+
+    INIT_LIST_HEAD(&q->head);
+    q->size = 0;
+    q->bytes = 0;
+    q->pooled = 0;
+    q->pool = NULL;
+    q->reversed = false;
+    q->mid = NULL;
+    q->sorted = true;
+    q->index = NULL;
+    q->indexed = false;
+    q->ring = NULL;
+    q->ringed = false;
+    q->chunks = NULL;
+    q->chunked = false;
+    q->linked = true;
+    q->intern = NULL;
+
+    if (q_intern_mode) {
+        q->intern = intern_new();
+        if (!q->intern) {
+            free(q);
+            return NULL;
+        }
+    }
+    if (q_pool_mode) {
+        q->pool = pool_new(q_pool_mode > 1);
+        if (!q->pool) {
+            if (q->intern)
+                intern_destroy(q->intern);
+            free(q);
+            return NULL;
+        }
+    }
+    if (q_pool_mode == 3) {
+        q->ring = malloc(sizeof(struct q_ring));
+        if (!q->ring) {
+            if (q->intern)
+                intern_destroy(q->intern);
+            pool_destroy(q->pool);
+            free(q);
+            return NULL;
+        }
+        q->ring->slots = NULL;
+        q->ring->cap = 0;
+        q->ring->first = 0;
+        q->ringed = true;
+    }
+    if (q_pool_mode == 4) {
+        q->chunks = malloc(sizeof(struct q_chunks));
+        if (!q->chunks) {
+            if (q->intern)
+                intern_destroy(q->intern);
+            pool_destroy(q->pool);
+            free(q);
+            return NULL;
+        }
+        INIT_LIST_HEAD(&q->chunks->list);
+        /* Taken by the first insert, so that it does not allocate either */
+        q->chunks->spare = malloc(sizeof(struct q_chunk));
+        q->chunks->count = 0;
+        q->chunked = true;
+    }
+
+    return &q->head;
+}
+
+/* Free all storage used by queue */
+void q_free(struct list_head *l)
+{
+    if (!l)
+        return;
+
+    queue_t *q = q_of(l);
+    struct q_pool *pool = q->pool;
+
+    if (q->index) {
+        skip_clear(q);
+        free(q->index);
+    }
+    if (q->ring) {
+        free(q->ring->slots);
+        free(q->ring);
+    }
+
+    /* Every element lives in the slabs and no other is held outside the
+     * queue, so the slabs can be dropped without walking the list.  The
+     * strings of the intern table then only have these elements for users.
+     */
+    bool whole = pool && q->pooled == q->size &&
+                 pool->live == (size_t) q->pooled &&
+                 (!q->intern || q->intern->refs == (size_t) q->size);
+
+    if (q->chunks) {
+        if (!whole)
+            chunk_link(q);
+        chunk_destroy(q->chunks);
+    }
+    if (whole) {
+        if (q->intern)
+            intern_destroy(q->intern);
+        pool_destroy(pool);
+        free(q);
+        return;
+    }
+
+    element_t *entry, *safe;
+    struct list_head *ahead;
+
+    /* free() reads allocator metadata next to each element, which overlaps
+     * with fetching the nodes ahead
+     */
+    list_for_each_entry_safe_prefetch (entry, safe, ahead, l, list)
+        q_release_element(entry);
+
+    if (pool) {
+        if (pool->live)
+            pool->orphan = true;
+        else
+            pool_destroy(pool);
+    }
+    if (q->intern) {
+        if (q->intern->strings)
+            q->intern->orphan = true;
+        else
+            intern_destroy(q->intern);
+    }
+    free(q);
+}
+
+/* Insert an element at head of queue */
+bool q_insert_head(struct list_head *head, char *s)
+{
+    if (!head)
+        return false;
+
+    queue_t *q = q_of(head);
+    element_t *new_element = element_new(q, s);
+
+    if (!new_element)
+        return false;
+    if (q->chunks && chunk_push(q, new_element, !q->reversed))
+        return true;
+
+    /* The head of a reversed queue is the tail of its list */
+    if (q->reversed)
+        list_add_tail(&new_element->list, head);
+    else
+        list_add(&new_element->list, head);
+    q_account_add(q, new_element);
+    mid_after_insert(q, &new_element->list, true);
+    sorted_after_insert(q, new_element);
+    if (q->indexed)
+        skip_after_insert(q, new_element, !q->reversed);
+    if (q->ring)
+        ring_after_insert(q, new_element, !q->reversed);
+
+    return true;
+}
+
+/* Insert an element at tail of queue */
+bool q_insert_tail(struct list_head *head, char *s)
+{
+    if (!head)
+        return false;
+
+    queue_t *q = q_of(head);
+    element_t *new_element = element_new(q, s);
+
+    if (!new_element)
+        return false;
+    if (q->chunks && chunk_push(q, new_element, q->reversed))
+        return true;
+
+    if (q->reversed)
+        list_add(&new_element->list, head);
+    else
+        list_add_tail(&new_element->list, head);
+    q_account_add(q, new_element);
+    mid_after_insert(q, &new_element->list, false);
+    sorted_after_insert(q, new_element);
+    if (q->indexed)
+        skip_after_insert(q, new_element, q->reversed);
+    if (q->ring)
+        ring_after_insert(q, new_element, q->reversed);
+
+    return true;
+}
+
+/* Insert an element in ascending order */
+bool q_insert_sorted(struct list_head *head, char *s)
+{
+    if (!head)
+        return false;
+
+    queue_t *q = q_of(head);
+
+    q_sort_cmps = 0;
+    if (!q_sorted(head))
+        return false;
+    q_link(q);
+    /* Only a queue of one element can be sorted and reversed */
+    q->reversed = false;
+    if (!q->indexed)
+        skip_build(q);
+
+    element_t *new_element = element_new(q, s);
+    if (!new_element)
+        return false;
+
+    struct q_skip *update[SKIP_LEVELS];
+    struct list_head *pos = head->prev;
+
+    if (q->indexed) {
+        pos = skip_find(q, new_element, update);
+    } else {
+        /* No memory for the index, walk back from the tail */
+        while (pos != head &&
+               (q_sort_cmps++, element_cmp(list_entry(pos, element_t, list),
+                                           new_element) > 0))
+            pos = pos->prev;
+    }
+
+    /* The middle moves as for an insert at the head if the new element goes
+     * before it, or at the tail if it goes after
+     */
+    bool before_mid =
+        q->mid &&
+        (q_sort_cmps++,
+         element_cmp(new_element, list_entry(q->mid, element_t, list)) < 0);
+    list_add(&new_element->list, pos);
+    q_account_add(q, new_element);
+    mid_after_insert(q, &new_element->list, before_mid);
+    if (q->indexed)
+        skip_link(q, new_element, update);
+    /* Only grows the ring, which has no slot for the middle of the list */
+    if (q->ring) {
+        q->ringed = false;
+        ring_after_insert(q, new_element, true);
+    }
+
+    return true;
+}
+
+/* Remove an element from head of queue */
+element_t *q_remove_head(struct list_head *head, char *sp, size_t bufsize)
+{
+    if (!head || list_empty(head))
+        return NULL;
+
+    queue_t *q = q_of(head);
+    element_t *target;
+
+    if (q->chunked) {
+        target = chunk_pop(q, !q->reversed);
+    } else {
+        target = list_entry(q_first(head), element_t, list);
+        mid_before_remove(q, true);
+        if (q->indexed)
+            skip_before_remove(q, target, !q->reversed);
+        if (q->ringed)
+            ring_before_remove(q, !q->reversed);
+        list_del_init(&target->list);
+        q_account_del(q, target);
+    }
+
+    if (sp) {
+        strncpy(sp, target->value, bufsize - 1);
+        sp[bufsize - 1] = '\0';
+    }
+
+    return target;
+}
+
+/* Remove an element from tail of queue */
+element_t *q_remove_tail(struct list_head *head, char *sp, size_t bufsize)
+{
+    if (!head || list_empty(head))
+        return NULL;
+
+    queue_t *q = q_of(head);
+    element_t *target;
+
+    if (q->chunked) {
+        target = chunk_pop(q, q->reversed);
+    } else {
+        target = list_entry(q_last(head), element_t, list);
+        mid_before_remove(q, false);
+        if (q->indexed)
+            skip_before_remove(q, target, q->reversed);
+        if (q->ringed)
+            ring_before_remove(q, q->reversed);
+        list_del_init(&target->list);
+        q_account_del(q, target);
+    }
+
+    if (sp) {
+        strncpy(sp, target->value, bufsize - 1);
+        sp[bufsize - 1] = '\0';
+    }
+
+    return target;
+}
+
+/* Return number of elements in queue */
+int q_size(struct list_head *head)
+{
+    if (!head)
+        return 0;
+
+    return q_of(head)->size;
+}
+
+/* Return the bytes of memory held by queue */
+size_t q_footprint(struct list_head *head)
+{
+    if (!head)
+        return 0;
+
+    queue_t *q = q_of(head);
+    size_t bytes = malloc_usage(sizeof(queue_t));
+
+    if (q->pool)
+        bytes += malloc_usage(sizeof(struct q_pool)) + q->pool->slab_bytes;
+    if (q->index) {
+        bytes += malloc_usage(sizeof(struct q_skip) +
+                              SKIP_LEVELS * sizeof(q->index->next[0]));
+        for (struct q_skip *node = q->index->next[0]; node;
+             node = node->next[0])
+            bytes += malloc_usage(sizeof(struct q_skip) +
+                                  node->height * sizeof(node->next[0]));
+    }
+    if (q->intern) {
+        struct q_intern_stats st;
+        q_intern_stats(head, &st);
+        bytes += st.overhead + st.bytes;
+    }
+    if (q->ring)
+        bytes += malloc_usage(sizeof(struct q_ring)) +
+                 (q->ring->cap ? malloc_usage(q->ring->cap *
+                                              sizeof(q->ring->slots[0]))
+                               : 0);
+    if (q->chunks)
+        bytes += malloc_usage(sizeof(struct q_chunks)) +
+                 (q->chunks->count + !!q->chunks->spare) *
+                     malloc_usage(sizeof(struct q_chunk));
+
+    /* The slabs of the pool of @q already count its own elements */
+    if (q->pooled == q->size)
+        return bytes;
+    if (q->chunks)
+        chunk_link(q);
+
+    element_t *e;
+    list_for_each_entry (e, head, list) {
+        if (!e->pool)
+            bytes += malloc_usage(element_size(e));
+        else if (e->pool != q->pool)
+            bytes += element_size(e);
+    }
+    return bytes;
+}
+
+/* Report on the intern table of queue */
+bool q_intern_stats(struct list_head *head, struct q_intern_stats *st)
+{
+    if (!head || !q_of(head)->intern)
+        return false;
+    if (!st)
+        return true;
+
+    struct q_intern *table = q_of(head)->intern;
+
+    st->strings = table->strings;
+    st->refs = table->refs;
+    st->bytes = 0;
+    st->saved = 0;
+    st->overhead = malloc_usage(sizeof(struct q_intern)) +
+                   malloc_usage((table->mask + 1) * sizeof(table->slots[0]));
+    for (size_t i = 0; i <= table->mask; i++) {
+        const struct q_istr *x = table->slots[i].x;
+        if (!x)
+            continue;
+        size_t len = strlen(x->str) + 1;
+        st->bytes += len;
+        st->saved += (x->refs - 1) * len;
+        st->overhead += malloc_usage(sizeof(struct q_istr) + len) - len;
+    }
+    return true;
+}
+
+/* Delete the middle node in queue */
+// https://leetcode.com/problems/delete-the-middle-node-of-a-linked-list/
+bool q_delete_mid(struct list_head *head)
+{
+    if (!head || list_empty(head))
+        return false;
+
+    queue_t *q = q_of(head);
+    q_link(q);
+    struct list_head *mid = q->mid;
+
+    /* Lost by an operation that relinked the queue, found again once */
+    if (!mid) {
+        mid = q_first(head);
+        for (int i = q->size / 2; i; i--)
+            mid = q_next(head, mid);
+    }
+
+    /* The one after it moves to size / 2 for an odd size, the one before it
+     * for an even size
+     */
+    if (q->size == 1)
+        q->mid = NULL;
+    else
+        q->mid = q->size & 1 ? q_next(head, mid) : q_prev(head, mid);
+    q->indexed = false;
+    q->ringed = false;
+
+    list_del(mid);
+    element_t *target = list_entry(mid, element_t, list);
+    q_account_del(q, target);
+    q_release_element(target);
+
+    return true;
+}
+
+/* Delete all nodes that have duplicate string */
+// https://leetcode.com/problems/remove-duplicates-from-sorted-list-ii/
+bool q_delete_dup(struct list_head *head)
+{
+    if (!head || list_empty(head))
+        return false;
+
+    queue_t *q = q_of(head);
+    bool dup = false;
+
+    q_link(q);
+    q->mid = NULL;
+    q->indexed = false;
+    q->ringed = false;
+    element_t *target, *temp;
+    struct list_head *ahead;
+
+    q_for_each_safe_prefetch (target, temp, ahead, head) {
+        if (target->list.next != head &&
+            (Q_COUNT(cmps, 1), !element_cmp(target, temp))) {
+            dup = true;
+            list_del(&target->list);
+            Q_COUNT(writes, 2);
+            q_account_del(q, target);
+            q_release_element(target);
+        } else if (dup) {
+            dup = false;
+            list_del(&target->list);
+            Q_COUNT(writes, 2);
+            q_account_del(q, target);
+            q_release_element(target);
+        }
+    }
+
+    return true;
+}
+
+/* Swap every two adjacent nodes */
+// https://leetcode.com/problems/swap-nodes-in-pairs/
+/*
+void q_swap(struct list_head *head)
+{
+
+    struct list_head *node = NULL;
+    for (node = head->next; node != head && node->next != head;
+         node = node->next) {
+        struct list_head *next = node->next;
+        list_move_tail(node, next);
+    }
+}
+*/
+
+void q_swap(struct list_head *head)
+{
+    if (!head || list_empty(head))
+        return;
+
+    q_reverseK(head, 2);
+}
+
+/* Reverse elements in queue */
+void q_reverse(struct list_head *head)
+{
+    if (!head)
+        return;
+
+    queue_t *q = q_of(head);
+    q->reversed = !q->reversed;
+    /* For an even size, index size / 2 is the other of the two middles */
+    if (q->mid && !(q->size & 1))
+        q->mid = q_next(head, q->mid);
+}
+
+/* Turn the links of a reversed queue around */
+void q_straighten(struct list_head *head)
+{
+    if (!head)
+        return;
+
+    q_link(q_of(head));
+    if (!q_of(head)->reversed)
+        return;
+
+    struct list_head *node = head;
+    do {
+        struct list_head *next = node->next;
+        node->next = node->prev;
+        node->prev = next;
+        node = next;
+    } while (node != head);
+    Q_COUNT(writes, 2 * (q_of(head)->size + 1));
+    q_of(head)->reversed = false;
+    /* Ascending links now descend */
+    q_of(head)->sorted = q_of(head)->size < 2;
+    q_of(head)->indexed = false;
+    q_of(head)->ringed = false;
+}
+
+/* Forget what a queue relinked behind its back knew about its order */
+void q_relinked(struct list_head *head, bool sorted)
+{
+    if (!head)
+        return;
+
+    q_of(head)->mid = NULL;
+    q_of(head)->sorted = sorted;
+    q_of(head)->indexed = false;
+    q_of(head)->ringed = false;
+    q_of(head)->chunked = false;
+}
+
+/* Call a function on each element of queue in reading order */
+int q_walk(struct list_head *head, bool (*fn)(element_t *, void *), void *arg)
+{
+    if (!head)
+        return 0;
+
+    queue_t *q = q_of(head);
+    int n = 0;
+
+    if (!q->chunked) {
+        for (struct list_head *node = q_first(head); node != head;
+             node = q_next(head, node)) {
+            n++;
+            if (!fn(list_entry(node, element_t, list), arg))
+                break;
+        }
+        return n;
+    }
+
+    /* The chunks keep the element pointers together, so the walk only
+     * waits on the elements themselves
+     */
+    struct list_head *pos = q->reversed ? q->chunks->list.prev
+                                        : q->chunks->list.next;
+    for (; pos != &q->chunks->list; pos = q->reversed ? pos->prev : pos->next) {
+        struct q_chunk *chunk = list_entry(pos, struct q_chunk, node);
+        for (int i = 0; i < chunk->last - chunk->first; i++) {
+            n++;
+            if (!fn(chunk->slots[q->reversed ? chunk->last - 1 - i
+                                             : chunk->first + i],
+                    arg))
+                return n;
+        }
+    }
+    return n;
+}
+
+/* Reverse the nodes of the list k at a time */
+// https://leetcode.com/problems/reverse-nodes-in-k-group/
+void q_reverseK(struct list_head *head, int k)
+{
+    if (!head || list_empty(head) || k == 1)
+        return;
+
+    q_straighten(head);
+    queue_t *q = q_of(head);
+    q->mid = NULL;
+    q->sorted = false;
+    q->indexed = false;
+
+    /* Reverse the groups in the ring and link the list after it.  As below,
+     * the last group is reversed too, however short.
+     */
+    if (k > 1 && ring_ready(q)) {
+        struct q_slot *slots = q->ring->slots;
+        for (int i = 0; i < q->size; i += k) {
+            int lo = i, hi = (q->size - i < k ? q->size : i + k) - 1;
+            for (; lo < hi; lo++, hi--) {
+                struct q_slot t = slots[lo];
+                slots[lo] = slots[hi];
+                slots[hi] = t;
+            }
+        }
+        ring_relink(q);
+        return;
+    }
+
+    q->ringed = false;
+    struct list_head *node = NULL, *safe = NULL, *insert = head;
+    int count = 0;
+
+    list_for_each_safe (node, safe, head) {
+        if (k > count)
+            list_move(node, insert);
+        else {
+            count = 0;
+            insert = node->prev;
+        }
+        count++;
+    }
+}
+
+/* Remove every node which has a node with a strictly greater value anywhere to
+ * the right side of it */
+// https://leetcode.com/problems/remove-nodes-from-linked-list/
+int q_descend(struct list_head *head)
+{
+    if (!head || list_empty(head))
+        return 0;
+
+    q_straighten(head);
+    queue_t *q = q_of(head);
+    struct list_head *target = head->prev, *prev = target->prev;
+
+    q->mid = NULL;
+    q->indexed = false;
+    q->ringed = false;
+
+    while (target->prev != head) {
+        element_t *t = list_entry(target, element_t, list);
+        element_t *p = list_entry(prev, element_t, list);
+
+        if (element_cmp(p, t) < 0) {
+            list_del(&p->list);
+            q_account_del(q, p);
+            q_release_element(p);
+            prev = target->prev;
+        } else {
+            target = prev;
+            prev = target->prev;
+        }
+    }
+
+    return q->size;
+}
+
+/* Compare the strings of two elements, counting the comparison */
+static inline int q_cmp(const struct list_head *a, const struct list_head *b)
+{
+    q_sort_cmps++;
+    Q_COUNT(cmps, 1);
+    return element_cmp(list_entry(a, element_t, list),
+                       list_entry(b, element_t, list));
+}
+
+/* Merge two null-terminated sorted lists, taking l1 first on ties */
+static inline struct list_head *mergelist(struct list_head *l1,
+                                          struct list_head *l2)
+{
+    struct list_head *head = NULL, **tail = &head;
+
+    /* The two runs are independent chains of loads, so fetching the node
+     * after each run head keeps both in flight
+     */
+    for (;;) {
+        list_prefetch(l1->next);
+        list_prefetch(l2->next);
+        Q_COUNT(writes, 1);
+        if (q_cmp(l1, l2) <= 0) {
+            *tail = l1;
+            tail = &l1->next;
+            l1 = l1->next;
+            if (!l1) {
+                *tail = l2;
+                break;
+            }
+        } else {
+            *tail = l2;
+            tail = &l2->next;
+            l2 = l2->next;
+            if (!l2) {
+                *tail = l1;
+                break;
+            }
+        }
+    }
+    Q_COUNT(writes, 1);
+
+    return head;
+}
+
+/* Merge the last two runs into @head, restoring the prev links on the way
+ * instead of in a separate pass over the sorted list.
+ */
+static void mergelist_final(struct list_head *head,
+                            struct list_head *l1,
+                            struct list_head *l2)
+{
+    struct list_head *tail = head;
+
+    for (;;) {
+        list_prefetch(l1->next);
+        list_prefetch(l2->next);
+        Q_COUNT(writes, 2);
+        if (q_cmp(l1, l2) <= 0) {
+            tail->next = l1;
+            l1->prev = tail;
+            tail = l1;
+            l1 = l1->next;
+            if (!l1)
+                break;
+        } else {
+            tail->next = l2;
+            l2->prev = tail;
+            tail = l2;
+            l2 = l2->next;
+            if (!l2) {
+                l2 = l1;
+                break;
+            }
+        }
+    }
+
+    // Connect the remain list
+    do {
+        Q_COUNT(writes, 2);
+        tail->next = l2;
+        l2->prev = tail;
+        tail = l2;
+        l2 = l2->next;
+    } while (l2);
+
+    tail->next = head;
+    head->prev = tail;
+    Q_COUNT(writes, 2);
+}
+
+/* Runs shorter than the minimum run length are extended by binary insertion,
+ * which needs fewer comparisons than merging runs of one or two elements.
+ */
+#define MIN_MERGE 32
+
+/* Pick a minimum run length in [MIN_MERGE / 2, MIN_MERGE] such that n / minrun
+ * is a power of two or slightly less, as Timsort does.
+ */
+static inline size_t minrun_of(size_t n)
+{
+    size_t r = 0;
+
+    while (n >= MIN_MERGE) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+/* Cut the run at the front of *list off and return it, null terminated and
+ * ascending.  A descending run is reversed while it is scanned, keeping equal
+ * neighbours in their original order so that the sort stays stable.  Runs
+ * shorter than @minrun are extended with the following elements.
+ */
+static struct list_head *run_cut(struct list_head **list,
+                                 size_t *len,
+                                 size_t minrun)
+{
+    struct list_head *head = *list, *cur = head->next;
+    size_t n = 1;
+
+    if (cur && q_cmp(head, cur) > 0) {
+        struct list_head *group = head; /* last of the elements equal to head */
+        int c = 1;
+
+        head->next = NULL;
+        Q_COUNT(writes, 1);
+        do {
+            struct list_head *next = cur->next;
+            if (c > 0) {
+                cur->next = head;
+                head = group = cur;
+                Q_COUNT(writes, 1);
+            } else {
+                cur->next = group->next;
+                group->next = cur;
+                group = cur;
+                Q_COUNT(writes, 2);
+            }
+            cur = next;
+            n++;
+        } while (cur && (c = q_cmp(head, cur)) >= 0);
+    } else if (cur) {
+        struct list_head *tail = cur;
+        n++;
+        for (cur = cur->next; cur && q_cmp(tail, cur) <= 0; cur = cur->next) {
+            tail = cur;
+            n++;
+        }
+        tail->next = NULL;
+        Q_COUNT(writes, 1);
+    }
+
+    if (n < minrun && cur) {
+        struct list_head *arr[MIN_MERGE];
+        size_t k = 0;
+
+        for (struct list_head *node = head; node; node = node->next)
+            arr[k++] = node;
+
+        /* Binary insertion after any equal element keeps it stable */
+        for (; k < minrun && cur; k++) {
+            struct list_head *node = cur;
+            size_t lo = 0, hi = k;
+
+            cur = cur->next;
+            while (lo < hi) {
+                size_t mid = (lo + hi) / 2;
+                if (q_cmp(node, arr[mid]) < 0)
+                    hi = mid;
+                else
+                    lo = mid + 1;
+            }
+            memmove(&arr[lo + 1], &arr[lo], (k - lo) * sizeof(*arr));
+            arr[lo] = node;
+        }
+
+        for (size_t i = 0; i + 1 < k; i++)
+            arr[i]->next = arr[i + 1];
+        arr[k - 1]->next = NULL;
+        Q_COUNT(writes, k);
+        head = arr[0];
+        n = k;
+    }
+
+    *list = cur;
+    *len = n;
+    return head;
+}
+
+/* Pending runs satisfy len[i] > len[i + 1] + len[i + 2], so their lengths
+ * grow at least as fast as the Fibonacci numbers and 64 slots cover any
+ * queue whose size fits in an int.
+ */
+#define MAX_RUNS 64
+
+struct run {
+    struct list_head *head;
+    size_t len;
+};
+
+/* Merge runs[k] with runs[k + 1] and drop the gap from the stack */
+static inline void run_merge_at(struct run *runs, size_t *n, size_t k)
+{
+    runs[k].head = mergelist(runs[k].head, runs[k + 1].head);
+    runs[k].len += runs[k + 1].len;
+    if (k + 2 < *n)
+        runs[k + 1] = runs[k + 2];
+    (*n)--;
+}
+
+/* Natural merge sort of the null-terminated list @list of @len elements.
+ *
+ * Runs are cut off the list from left to right and pushed on a stack whose
+ * invariants (the ones Timsort uses, including the fix by de Gouw et al.) keep
+ * every merge balanced.  Sorted or reverse-sorted input is a single run and
+ * costs n - 1 comparisons.  At most two runs are left in @runs so that the
+ * caller can fold its own work into the last merge; their count is returned.
+ */
+static size_t merge_sort_runs(struct list_head *list,
+                              size_t len,
+                              struct run *runs)
+{
+    size_t n = 0, minrun = minrun_of(len);
+
+    while (list) {
+        runs[n].head = run_cut(&list, &runs[n].len, minrun);
+        n++;
+
+        while (n > 1) {
+            size_t k = n - 2;
+            if ((k > 0 && runs[k - 1].len <= runs[k].len + runs[k + 1].len) ||
+                (k > 1 && runs[k - 2].len <= runs[k - 1].len + runs[k].len)) {
+                if (runs[k - 1].len < runs[k + 1].len)
+                    k--;
+            } else if (runs[k].len > runs[k + 1].len) {
+                break;
+            }
+            run_merge_at(runs, &n, k);
+        }
+    }
+
+    while (n > 2) {
+        size_t k = n - 2;
+        if (runs[k - 1].len < runs[k + 1].len)
+            k--;
+        run_merge_at(runs, &n, k);
+    }
+
+    return n;
+}
+
+/* Sort the null-terminated list @list of @len elements, setting *@tailp to
+ * its last element
+ */
+static struct list_head *merge_sort_list(struct list_head *list,
+                                         size_t len,
+                                         struct list_head **tailp)
+{
+    struct run runs[MAX_RUNS];
+
+    if (merge_sort_runs(list, len, runs) == 2)
+        list = mergelist(runs[0].head, runs[1].head);
+    else
+        list = runs[0].head;
+
+    struct list_head *tail = list;
+    while (tail->next)
+        tail = tail->next;
+    *tailp = tail;
+    return list;
+}
+
+/* Buckets smaller than RADIX_CUTOFF, or still undecided after
+ * RADIX_MAX_DEPTH bytes, are finished by the merge sort.  The depth limit
+ * bounds the stack used by the per-level buckets.
+ */
+#define RADIX_CUTOFF 32
+#define RADIX_MAX_DEPTH 16
+
+/* Stable MSD radix sort on the bytes from @depth on of the strings in the
+ * null-terminated list @list of @len elements, all of which share their
+ * first @depth bytes.  Buckets are linked lists, so nothing is allocated.
+ */
+static struct list_head *radix_sort(struct list_head *list,
+                                    size_t len,
+                                    size_t depth,
+                                    struct list_head **tailp)
+{
+    if (len < RADIX_CUTOFF || depth >= RADIX_MAX_DEPTH)
+        return merge_sort_list(list, len, tailp);
+#if KEY_PACK
+    /* Past the packed key, which does not line up with the bytes of the
+     * strings, every key in the bucket is the same
+     */
+    if (depth >= sizeof(uint64_t))
+        return merge_sort_list(list, len, tailp);
+#endif
+
+    struct list_head *heads[256], **tails[256];
+    size_t counts[256] = {0};
+
+    for (int c = 0; c < 256; c++)
+        tails[c] = &heads[c];
+
+    for (struct list_head *node = list; node; node = node->next) {
+        element_t *e = list_entry(node, element_t, list);
+        unsigned char c;
+#if KEY_PREFIX
+        if (depth < sizeof(e->key))
+            c = e->key >> (8 * (sizeof(e->key) - 1 - depth));
+        else
+#endif
+            c = e->value[depth];
+        *tails[c] = node;
+        tails[c] = &node->next;
+        counts[c]++;
+        Q_COUNT(bytes, 1);
+        Q_COUNT(writes, 1);
+    }
+
+    struct list_head *sorted = NULL, **link = &sorted, *tail = NULL;
+
+    for (int c = 0; c < 256; c++) {
+        if (!counts[c])
+            continue;
+        *tails[c] = NULL;
+        Q_COUNT(writes, 2);
+
+        /* Strings ending here are equal and already in input order, but a
+         * zero byte of a packed key does not end the string
+         */
+        if ((c || KEY_PACK) && counts[c] > 1) {
+            *link = radix_sort(heads[c], counts[c], depth + 1, &tail);
+        } else {
+            *link = heads[c];
+            tail = list_entry(tails[c], struct list_head, next);
+        }
+        link = &tail->next;
+    }
+
+    *tailp = tail;
+    return sorted;
+}
+
+/* Link the null-terminated sorted list @list back into the circular @head */
+static void relink(struct list_head *head, struct list_head *list)
+{
+    struct list_head *temp = head, *next = list;
+
+    head->next = list;
+    while (next) {
+        next->prev = temp;
+        temp = next;
+        next = next->next;
+        Q_COUNT(writes, 1);
+    }
+    temp->next = head;
+    head->prev = temp;
+    Q_COUNT(writes, 3);
+}
+
+/* The Q_SORT_LIST engine: list_sort() with q_cmp() inlined */
+#define LIST_SORT_NAME list_sort_q
+#define LIST_SORT_CTX void *
+#define LIST_SORT_CMP(ctx, a, b) q_cmp(a, b)
+#define LIST_SORT_WRITES(ctx, n) Q_COUNT(writes, n)
+#include "list_sort_template.h"
+
+/* Sort the null-terminated list @list of at least two elements with
+ * list_sort_q(), setting *@tailp to its last element
+ */
+static struct list_head *list_sort_list(struct list_head *list,
+                                        struct list_head **tailp)
+{
+    struct list_head head = {.next = list}, *tail = list;
+
+    /* list_sort_q() takes a circular list apart from its last element */
+    while (tail->next)
+        tail = tail->next;
+    tail->next = &head;
+    head.prev = tail;
+
+    list_sort_q(NULL, &head);
+    head.prev->next = NULL;
+    Q_COUNT(writes, 2);
+    *tailp = head.prev;
+    return head.next;
+}
+
+/* Sort the null-terminated list @list of @len elements with engine @algo,
+ * setting *@tailp to its last element
+ */
+static struct list_head *sort_list(struct list_head *list,
+                                   size_t len,
+                                   int algo,
+                                   struct list_head **tailp)
+{
+    if (algo == Q_SORT_RADIX)
+        return radix_sort(list, len, 0, tailp);
+    if (algo == Q_SORT_LIST)
+        return list_sort_list(list, tailp);
+    return merge_sort_list(list, len, tailp);
+}
+
+/* Each thread of a parallel sort gets at least this many elements, so that
+ * thread start-up stays small next to the work handed out.
+ */
+#define SORT_THREAD_MIN 16384
+#define SORT_MAX_THREADS 64
+
+/**
+ * struct sort_job - A piece of work of a parallel q_sort()
+ * @fn: what to do, run on its own thread or on the caller's
+ * @l1: segment to sort, or the first of two lists to merge
+ * @l2: the second list to merge
+ * @len: the number of elements to sort, or to take from @l1 and @l2
+ * @algo: the engine to sort with, one of Q_SORT_* but Q_SORT_AUTO
+ * @head: first element of the doubly-linked, null-terminated result
+ * @tail: last element of the result
+ * @cmps: comparisons made by the job
+ * @ties: key prefix ties met by the job
+ * @counters: work counted by the job under Q_STATS
+ */
+struct sort_job {
+    pthread_t thread;
+    bool spawned;
+    void (*fn)(struct sort_job *job);
+    struct list_head *l1, *l2;
+    size_t len;
+    int algo;
+    struct list_head *head, *tail;
+    size_t cmps, ties;
+    struct q_counters counters;
+};
+
+/* Sort a segment and give it back its prev links */
+static void job_sort(struct sort_job *job)
+{
+    struct list_head *prev = NULL;
+
+    job->head = sort_list(job->l1, job->len, job->algo, &job->tail);
+    for (struct list_head *node = job->head; node; node = node->next) {
+        node->prev = prev;
+        prev = node;
+        Q_COUNT(writes, 1);
+    }
+}
+
+/* Take the @len smallest elements of the sorted lists starting at @l1 and
+ * @l2, preferring @l1 on ties.  Only the links of the taken elements are
+ * written, so job_merge_back() can work on the same lists at the same time.
+ */
+static void job_merge_front(struct sort_job *job)
+{
+    struct list_head *l1 = job->l1, *l2 = job->l2, dummy, *tail = &dummy;
+
+    for (size_t i = 0; i < job->len; i++) {
+        struct list_head *node;
+        if (!l2 || (l1 && q_cmp(l1, l2) <= 0)) {
+            node = l1;
+            l1 = l1->next;
+        } else {
+            node = l2;
+            l2 = l2->next;
+        }
+        tail->next = node;
+        node->prev = tail;
+        tail = node;
+        Q_COUNT(writes, 2);
+    }
+
+    tail->next = NULL;
+    job->head = dummy.next;
+    job->head->prev = NULL;
+    Q_COUNT(writes, 2);
+    job->tail = tail;
+}
+
+/* Take the @len largest elements of the sorted lists ending at @l1 and @l2,
+ * walking backwards and preferring @l2 on ties
+ */
+static void job_merge_back(struct sort_job *job)
+{
+    struct list_head *l1 = job->l1, *l2 = job->l2, dummy, *head = &dummy;
+
+    for (size_t i = 0; i < job->len; i++) {
+        struct list_head *node;
+        if (!l2 || (l1 && q_cmp(l1, l2) > 0)) {
+            node = l1;
+            l1 = l1->prev;
+        } else {
+            node = l2;
+            l2 = l2->prev;
+        }
+        node->next = head;
+        head->prev = node;
+        head = node;
+        Q_COUNT(writes, 2);
+    }
+
+    head->prev = NULL;
+    job->head = head;
+    job->tail = dummy.prev;
+    job->tail->next = NULL;
+    Q_COUNT(writes, 2);
+}
+
+static void *job_run(void *arg)
+{
+    struct sort_job *job = arg;
+    size_t cmps = q_sort_cmps, ties = q_key_ties;
+#if Q_STATS
+    struct q_counters counters = q_counters;
+#endif
+
+    job->fn(job);
+    job->cmps = q_sort_cmps - cmps;
+    job->ties = q_key_ties - ties;
+    q_sort_cmps = cmps;
+    q_key_ties = ties;
+#if Q_STATS
+    job->counters.cmps = q_counters.cmps - counters.cmps;
+    job->counters.writes = q_counters.writes - counters.writes;
+    job->counters.bytes = q_counters.bytes - counters.bytes;
+    q_counters = counters;
+#endif
+    return NULL;
+}
+
+/* Run @n jobs, the first on the calling thread, and wait for all of them.
+ * A job whose thread cannot be created is run in place.
+ */
+static void jobs_run(struct sort_job *jobs, int n)
+{
+    for (int i = 1; i < n; i++)
+        jobs[i].spawned =
+            !pthread_create(&jobs[i].thread, NULL, job_run, &jobs[i]);
+    for (int i = 0; i < n; i++) {
+        if (!jobs[i].spawned)
+            job_run(&jobs[i]);
+    }
+    for (int i = 0; i < n; i++) {
+        if (jobs[i].spawned)
+            pthread_join(jobs[i].thread, NULL);
+        jobs[i].spawned = false;
+        q_sort_cmps += jobs[i].cmps;
+        q_key_ties += jobs[i].ties;
+        Q_COUNT(cmps, jobs[i].counters.cmps);
+        Q_COUNT(writes, jobs[i].counters.writes);
+        Q_COUNT(bytes, jobs[i].counters.bytes);
+    }
+}
+
+/* Sort the @len elements of @head on @nthreads threads with engine @algo.
+ *
+ * The list is cut into one contiguous segment per thread and the segments
+ * are sorted concurrently.  Neighbouring segments are then merged pairwise,
+ * each merge split between two threads: one takes the smaller half of the
+ * elements from the front of both lists and the other the larger half from
+ * their back, so even the last merge runs on two cores.  Segments keep their
+ * order and every tie goes to the earlier one, which keeps the sort stable.
+ *
+ * Signals stay blocked while the jobs run, so a time limit raised by the
+ * harness fires once the list is whole again instead of while other threads
+ * still work on it.
+ */
+static void sort_parallel(struct list_head *head,
+                          size_t len,
+                          int nthreads,
+                          int algo)
+{
+    struct sort_job jobs[SORT_MAX_THREADS] = {0};
+    struct list_head *list = head->next;
+    sigset_t all, old;
+
+    for (int i = 0; i < nthreads; i++) {
+        size_t n = len / nthreads + (i < len % nthreads);
+        jobs[i].fn = job_sort;
+        jobs[i].algo = algo;
+        jobs[i].l1 = list;
+        jobs[i].len = n;
+        while (--n)
+            list = list->next;
+        struct list_head *last = list;
+        list = list->next;
+        last->next = NULL;
+        Q_COUNT(writes, 1);
+    }
+
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+
+    jobs_run(jobs, nthreads);
+
+    int nsegs = nthreads;
+    struct sort_job segs[SORT_MAX_THREADS];
+    for (int i = 0; i < nsegs; i++) {
+        segs[i].head = jobs[i].head;
+        segs[i].tail = jobs[i].tail;
+        segs[i].len = jobs[i].len;
+    }
+
+    while (nsegs > 1) {
+        int njobs = 0;
+
+        for (int i = 0; i + 1 < nsegs; i += 2) {
+            size_t n = segs[i].len + segs[i + 1].len;
+            jobs[njobs].fn = job_merge_front;
+            jobs[njobs].l1 = segs[i].head;
+            jobs[njobs].l2 = segs[i + 1].head;
+            jobs[njobs].len = n - n / 2;
+            njobs++;
+            jobs[njobs].fn = job_merge_back;
+            jobs[njobs].l1 = segs[i].tail;
+            jobs[njobs].l2 = segs[i + 1].tail;
+            jobs[njobs].len = n / 2;
+            njobs++;
+        }
+
+        jobs_run(jobs, njobs);
+
+        for (int i = 0; i < njobs; i += 2) {
+            struct sort_job *seg = &segs[i / 2];
+            jobs[i].tail->next = jobs[i + 1].head;
+            jobs[i + 1].head->prev = jobs[i].tail;
+            Q_COUNT(writes, 2);
+            seg->head = jobs[i].head;
+            seg->tail = jobs[i + 1].tail;
+            seg->len = jobs[i].len + jobs[i + 1].len;
+        }
+        if (nsegs & 1)
+            segs[njobs / 2] = segs[nsegs - 1];
+        nsegs = (nsegs + 1) / 2;
+    }
+
+    head->next = segs[0].head;
+    segs[0].head->prev = head;
+    head->prev = segs[0].tail;
+    segs[0].tail->next = head;
+    Q_COUNT(writes, 4);
+
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+}
+
+/* Q_SORT_AUTO looks at the first SORT_SAMPLE_SPAN elements only: at every
+ * pair of neighbours for the runs, and at every SORT_SAMPLE_STRIDE-th
+ * element for the duplicates and the keys.  Queues shorter than
+ * SORT_SAMPLE_MIN go to the merge engine without a look.
+ */
+#define SORT_SAMPLE_SPAN 1024
+#define SORT_SAMPLE_STRIDE 8
+#define SORT_SAMPLE_MIN 8192
+
+/* Length of the prefix shared by the strings of two elements */
+static size_t common_prefix(const element_t *a, const element_t *b)
+{
+    size_t n = 0;
+
+    while (a->value[n] && a->value[n] == b->value[n])
+        n++;
+    return n;
+}
+
+/* Radix sort when it should take at most this many passes over the queue */
+#define SORT_RADIX_DEPTH 3.0
+
+/* Sample the queue and pick the engine for it, filling in @st */
+static int sort_choose(struct list_head *head,
+                       size_t len,
+                       struct q_sort_stats *st)
+{
+    struct list_head *sample[SORT_SAMPLE_SPAN / SORT_SAMPLE_STRIDE];
+    struct list_head *node = head->next;
+    size_t span = len < SORT_SAMPLE_SPAN ? len : SORT_SAMPLE_SPAN;
+    size_t n = 0, key_len = 0, prefix = 0;
+    bool seen[256] = {false};
+
+    for (size_t i = 0; i < span; i++, node = node->next) {
+        if (i + 1 < span && q_cmp(node, node->next) > 0)
+            st->descents++;
+        if (i % SORT_SAMPLE_STRIDE)
+            continue;
+
+        /* Binary insertion keeps the sample sorted */
+        size_t lo = 0, hi = n;
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (q_cmp(node, sample[mid]) < 0)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+        memmove(&sample[lo + 1], &sample[lo], (n - lo) * sizeof(*sample));
+        sample[lo] = node;
+        n++;
+
+        const char *str = list_entry(node, element_t, list)->value;
+        for (; *str; str++, key_len++)
+            seen[(unsigned char) *str] = true;
+    }
+
+    for (size_t i = 1; i < n; i++) {
+        const element_t *a = list_entry(sample[i - 1], element_t, list);
+        const element_t *b = list_entry(sample[i], element_t, list);
+        size_t p = common_prefix(a, b);
+        if (!a->value[p] && !b->value[p])
+            st->dups++;
+        prefix += p;
+    }
+
+    for (int c = 0; c < 256; c++)
+        st->alphabet += seen[c];
+
+    st->sampled = n;
+    st->pairs = span - 1;
+    st->key_len = (double) key_len / n;
+    st->prefix = n > 1 ? (double) prefix / (n - 1) : 0;
+
+    /* The radix sort passes over the queue once per byte of the prefix that
+     * neighbours share once sorted.  Of the prefix shared in the sample,
+     * log(n) / log(alphabet) bytes are owed to the sample being n elements,
+     * and the rest is common to the whole queue.
+     */
+    double log_alpha = log(st->alphabet > 2 ? st->alphabet : 2);
+    double common = st->prefix - log(n) / log_alpha;
+    st->depth = (common > 0 ? common : 0) + log(len) / log_alpha;
+
+    /* Few neighbours out of order, or nearly all of them, mean long runs
+     * that the merge engine takes whole
+     */
+    if (st->descents * 8 <= st->pairs || st->descents * 8 >= st->pairs * 7)
+        return Q_SORT_MERGE;
+    /* Equal strings fall into one radix bucket and stay there, where
+     * comparisons would have to read them to the end
+     */
+    if (st->dups * 4 >= n || st->depth <= SORT_RADIX_DEPTH)
+        return Q_SORT_RADIX;
+    /* Long shared prefixes or a small alphabet make for many radix passes,
+     * and list_sort() does the least work per element of the others
+     */
+    return Q_SORT_LIST;
+}
+
+/* Sort elements of queue in ascending order */
+void q_sort(struct list_head *head)
+{
+    if (!head)
+        return;
+
+    queue_t *q = q_of(head);
+
+    q_link(q);
+    if (q->sorted) {
+        /* Sorted before a q_reverse(), which another one undoes */
+        if (q->reversed)
+            q_reverse(head);
+        q_sort_cmps = 0;
+        memset(&q_sort_stats, 0, sizeof(q_sort_stats));
+        q_sort_stats.presorted = true;
+        return;
+    }
+
+    /* The order the elements come in makes no difference to the result */
+    q->reversed = false;
+    q->mid = NULL;
+    q->sorted = true;
+    q->indexed = false;
+    if (list_empty(head) || list_is_singular(head))
+        return;
+
+    size_t len = q_size(head);
+    struct list_head *tail;
+    int nthreads = q_sort_threads;
+    int algo = q_sort_algo;
+
+    q_sort_cmps = 0;
+    memset(&q_sort_stats, 0, sizeof(q_sort_stats));
+
+    /* A ring queue sorts its array, merging through the free half of it */
+    if (ring_ready(q)) {
+        q_sort_stats.algo = Q_SORT_RING;
+        ring_merge_sort(q->ring->slots, len, q->ring->slots + len);
+        ring_relink(q);
+        return;
+    }
+    q->ringed = false;
+
+    if (algo == Q_SORT_AUTO) {
+        double start = clock_now();
+        algo = len < SORT_SAMPLE_MIN ? Q_SORT_MERGE
+                                     : sort_choose(head, len, &q_sort_stats);
+        q_sort_stats.sample_time = clock_now() - start;
+    }
+    q_sort_stats.algo = algo;
+
+    if (nthreads > SORT_MAX_THREADS)
+        nthreads = SORT_MAX_THREADS;
+    if ((size_t) nthreads > len / SORT_THREAD_MIN)
+        nthreads = len / SORT_THREAD_MIN;
+    if (nthreads > 1) {
+        sort_parallel(head, len, nthreads, algo);
+        return;
+    }
+
+    if (algo == Q_SORT_LIST) {
+        list_sort_q(NULL, head);
+        return;
+    }
+
+    // Turn the list into Singly-linked list
+    head->prev->next = NULL;
+    Q_COUNT(writes, 1);
+
+    if (algo == Q_SORT_RADIX) {
+        relink(head, sort_list(head->next, len, algo, &tail));
+        return;
+    }
+
+    struct run runs[MAX_RUNS];
+    if (merge_sort_runs(head->next, len, runs) == 2)
+        mergelist_final(head, runs[0].head, runs[1].head);
+    else
+        relink(head, runs[0].head);
+}
+
+/* Number of queues a loser tree merges in one pass.  Longer chains are
+ * folded in batches, with the result so far as the first source.
+ */
+#define MERGE_WAYS 1024
+
+/* Does the head of source a come before the head of source b?  Index @k is
+ * a virtual source that beats everything, used to fill the tree; exhausted
+ * sources lose to everything, and ties go to the lower index so that the
+ * merge is stable across the chain.
+ */
+static inline bool merge_beats(struct list_head **src, int k, int a, int b)
+{
+    if (a == k || b == k)
+        return a == k;
+    if (!src[b])
+        return true;
+    if (!src[a])
+        return false;
+
+    int c = q_cmp(src[a], src[b]);
+    return c < 0 || (c == 0 && a < b);
+}
 
-    return head;
+/* Replay the matches from leaf @s up to the root after its head changed */
+static inline void loser_tree_adjust(int *tree,
+                                     struct list_head **src,
+                                     int k,
+                                     int s)
+{
+    for (int t = (s + k) >> 1; t > 0; t >>= 1) {
+        if (merge_beats(src, k, tree[t], s)) {
+            int winner = tree[t];
+            tree[t] = s;
+            s = winner;
+        }
+    }
+    tree[0] = s;
 }
 
-/* Free all storage used by queue */
-void q_free(struct list_head *l)
+/* Merge the null-terminated sorted lists src[0..k) and append them to the
+ * circular list @head, linking each node once
+ */
+static void merge_k(struct list_head *head, struct list_head **src, int k)
 {
-    if (!l)
-        return;
+    int tree[MERGE_WAYS];
+    struct list_head *tail = head->prev;
+
+    for (int t = 0; t < k; t++)
+        tree[t] = k;
+    for (int s = k - 1; s >= 0; s--)
+        loser_tree_adjust(tree, src, k, s);
+
+    for (;;) {
+        int w = tree[0];
+        struct list_head *node = src[w];
+        if (!node)
+            break;
+
+        src[w] = node->next;
+        tail->next = node;
+        node->prev = tail;
+        tail = node;
+        Q_COUNT(writes, 2);
+        loser_tree_adjust(tree, src, k, w);
+        /* The new head was just compared; fetch its successor for when it
+         * wins in turn
+         */
+        if (src[w])
+            list_prefetch(src[w]->next);
+    }
 
-    element_t *entry, *safe;
+    tail->next = head;
+    head->prev = tail;
+    Q_COUNT(writes, 2);
+}
 
-    list_for_each_entry_safe (entry, safe, l, list)
-        q_release_element(entry);
+/* Detach the elements of @head as a null-terminated list */
+static inline struct list_head *list_detach(struct list_head *head)
+{
+    struct list_head *list = NULL;
 
-    free(l);
+    if (!list_empty(head)) {
+        list = head->next;
+        head->prev->next = NULL;
+        Q_COUNT(writes, 1);
+    }
+    INIT_LIST_HEAD(head);
+    Q_COUNT(writes, 2);
+    return list;
 }
 
-/* Insert an element at head of queue */
-bool q_insert_head(struct list_head *head, char *s)
+/* Leave queue @head ascending along its links, as merge_k() takes it.  Free
+ * for a queue known to be sorted, whose comparisons count towards the merge
+ * otherwise.
+ */
+static void merge_prepare(struct list_head *head)
 {
-    if (!head)
-        return false;
-
-    element_t *new_element = malloc(sizeof(element_t));
+    size_t cmps = q_sort_cmps;
 
-    if (!new_element)
-        return false;
+    q_sort(head);
+    q_sort_cmps += cmps;
+}
 
-    new_element->value = strdup(s);
+/* Merge all the queues into one sorted queue, which is in ascending order */
+// https://leetcode.com/problems/merge-k-sorted-lists/
+int q_merge(struct list_head *head)
+{
+    if (!head || list_empty(head))
+        return 0;
 
-    if (!new_element->value) {
-        free(new_element);
-        return false;
+    queue_contex_t *cur = list_entry(head->next, queue_contex_t, chain);
+    queue_t *q = q_of(cur->q);
+    struct list_head *src[MERGE_WAYS];
+    struct list_head *temp = head->next->next;
+
+    q_sort_cmps = 0;
+    merge_prepare(cur->q);
+    q->mid = NULL;
+    q->indexed = false;
+    q->ringed = false;
+
+    while (temp != head) {
+        int k = 0;
+
+        src[k++] = list_detach(cur->q);
+        for (; k < MERGE_WAYS && temp != head; temp = temp->next) {
+            queue_contex_t *t = list_entry(temp, queue_contex_t, chain);
+            queue_t *from = q_of(t->q);
+
+            merge_prepare(t->q);
+            src[k++] = list_detach(t->q);
+            q->size += from->size;
+            q->bytes += from->bytes;
+            from->size = 0;
+            from->bytes = 0;
+            from->pooled = 0;
+            from->mid = NULL;
+            from->sorted = true;
+            from->indexed = false;
+            from->ringed = false;
+        }
+        merge_k(cur->q, src, k);
     }
 
-    list_add(&new_element->list, head);
+    return q->size;
+}
 
-    return true;
+/* Each stdio buffer of the external sort gets at least this many bytes */
+#define EXT_BUFFER_MIN 4096
+
+/**
+ * struct ext_sort - State of a q_sort_external()
+ * @q: the queue being sorted
+ * @budget: cap on @mem
+ * @mem: working memory held, apart from the elements of the queue
+ * @runs: descriptors of the temporary files holding sorted runs
+ * @nruns: the number of entries of @runs
+ * @cap: the capacity of @runs
+ * @rest: sorted elements kept in memory after a run failed to spill
+ * @stats: what the sort did so far
+ */
+struct ext_sort {
+    queue_t *q;
+    size_t budget;
+    size_t mem;
+    int *runs;
+    size_t nruns, cap;
+    struct list_head *rest;
+    struct q_ext_stats *stats;
+};
+
+/* A sorted run being merged, from a file or from the @rest list */
+struct ext_reader {
+    FILE *file;
+    struct list_head *list;
+    char *iobuf;
+    size_t iosize;
+    char *rec;
+    size_t cap;
+    const char *cur;
+    size_t len;
+};
+
+/* Account for @size bytes of working memory coming (or going, if negative) */
+static inline void ext_mem(struct ext_sort *ctx, ptrdiff_t size)
+{
+    ctx->mem += size;
+    if (ctx->stats->peak < ctx->mem)
+        ctx->stats->peak = ctx->mem;
 }
 
-/* Insert an element at tail of queue */
-bool q_insert_tail(struct list_head *head, char *s)
+/* Working memory left in the budget */
+static inline size_t ext_avail(const struct ext_sort *ctx)
 {
-    if (!head)
-        return false;
+    return ctx->budget > ctx->mem ? ctx->budget - ctx->mem : 0;
+}
 
-    element_t *new_element = malloc(sizeof(element_t));
+/* Size of each of the @n stdio buffers that share what is left of the
+ * budget with the records being merged
+ */
+static inline size_t ext_iosize(const struct ext_sort *ctx, size_t n)
+{
+    size_t size = ext_avail(ctx) / (n + 1);
+    return size < EXT_BUFFER_MIN / 4 ? EXT_BUFFER_MIN / 4 : size;
+}
 
-    if (!new_element)
-        return false;
+static void *ext_alloc(struct ext_sort *ctx, size_t size)
+{
+    void *p = malloc(size);
 
-    new_element->value = strdup(s);
+    if (p)
+        ext_mem(ctx, size);
+    return p;
+}
 
-    if (!new_element->value) {
-        free(new_element);
-        return false;
+static void ext_free(struct ext_sort *ctx, void *p, size_t size)
+{
+    if (p) {
+        free(p);
+        ext_mem(ctx, -(ptrdiff_t) size);
     }
+}
 
-    list_add_tail(&new_element->list, head);
+/* Write the @len bytes of @s as a LEB128 length followed by the bytes,
+ * returning the size of the record
+ */
+static size_t ext_put(FILE *f, const char *s, size_t len)
+{
+    size_t v = len, n = len + 1;
 
-    return true;
+    for (; v >= 0x80; v >>= 7, n++)
+        putc((int) (v & 0x7f) | 0x80, f);
+    putc((int) v, f);
+    fwrite(s, 1, len, f);
+    return n;
 }
 
-/* Remove an element from head of queue */
-element_t *q_remove_head(struct list_head *head, char *sp, size_t bufsize)
+/* Load the next string of @r into r->cur, which is NULL past the end.
+ * Return false if the string could not be read.
+ */
+static bool ext_next(struct ext_sort *ctx, struct ext_reader *r)
 {
-    if (!head || list_empty(head))
-        return NULL;
-
-    element_t *target = list_first_entry(head, element_t, list);
-    list_del_init(&target->list);
+    r->cur = NULL;
 
-    if (sp) {
-        strncpy(sp, target->value, bufsize - 1);
-        sp[bufsize - 1] = '\0';
+    if (!r->file) {
+        if (r->list) {
+            r->cur = list_entry(r->list, element_t, list)->value;
+            r->len = strlen(r->cur);
+        }
+        return true;
     }
 
-    return target;
+    size_t len = 0;
+    int c, shift = 0;
+    do {
+        c = getc(r->file);
+        if (c == EOF)
+            return !shift && !ferror(r->file);
+        len |= (size_t) (c & 0x7f) << shift;
+        shift += 7;
+    } while (c & 0x80);
+
+    if (len >= r->cap) {
+        size_t cap = r->cap ? r->cap : 64;
+        while (cap <= len)
+            cap <<= 1;
+        char *rec = ext_alloc(ctx, cap);
+        if (!rec)
+            return false;
+        ext_free(ctx, r->rec, r->cap);
+        r->rec = rec;
+        r->cap = cap;
+    }
+    if (fread(r->rec, 1, len, r->file) != len)
+        return false;
+    r->rec[len] = '\0';
+    r->cur = r->rec;
+    r->len = len;
+    return true;
 }
 
-/* Remove an element from tail of queue */
-element_t *q_remove_tail(struct list_head *head, char *sp, size_t bufsize)
+/* Does the string of reader a come before that of reader b?  Works like
+ * merge_beats(), ties going to the earlier run.
+ */
+static inline bool ext_beats(struct ext_reader *r, int k, int a, int b)
 {
-    if (!head || list_empty(head))
-        return NULL;
+    if (a == k || b == k)
+        return a == k;
+    if (!r[b].cur)
+        return true;
+    if (!r[a].cur)
+        return false;
 
-    element_t *target = list_last_entry(head, element_t, list);
-    list_del_init(&target->list);
+    q_sort_cmps++;
+    int c = strcmp(r[a].cur, r[b].cur);
+    return c < 0 || (c == 0 && a < b);
+}
 
-    if (sp) {
-        strncpy(sp, target->value, bufsize - 1);
-        sp[bufsize - 1] = '\0';
+static inline void ext_adjust(int *tree, struct ext_reader *r, int k, int s)
+{
+    for (int t = (s + k) >> 1; t > 0; t >>= 1) {
+        if (ext_beats(r, k, tree[t], s)) {
+            int winner = tree[t];
+            tree[t] = s;
+            s = winner;
+        }
     }
+    tree[0] = s;
+}
 
-    return target;
+/* Open a file run for reading from its start, through a buffer of @iosize
+ * bytes.  The descriptor is owned by the stream from then on.
+ */
+static bool ext_open(struct ext_sort *ctx,
+                     struct ext_reader *r,
+                     int fd,
+                     size_t iosize)
+{
+    if (lseek(fd, 0, SEEK_SET) < 0 || !(r->file = fdopen(fd, "rb"))) {
+        close(fd);
+        return false;
+    }
+    r->iobuf = ext_alloc(ctx, iosize);
+    if (r->iobuf) {
+        r->iosize = iosize;
+        setvbuf(r->file, r->iobuf, _IOFBF, iosize);
+    }
+    return true;
 }
 
-/* Return number of elements in queue */
-int q_size(struct list_head *head)
+static void ext_close(struct ext_sort *ctx, struct ext_reader *r)
 {
-    if (!head || list_empty(head))
-        return 0;
+    if (r->file)
+        fclose(r->file);
+    ext_free(ctx, r->iobuf, r->iosize);
+    ext_free(ctx, r->rec, r->cap);
+}
 
-    int size = 0;
-    struct list_head *li;
+/* Merge the @k runs of @r into the file @out, or back into the queue when
+ * @out is NULL, with a loser tree as q_merge() does
+ */
+static bool ext_merge(struct ext_sort *ctx,
+                      struct ext_reader *r,
+                      int k,
+                      FILE *out)
+{
+    int tree[MERGE_WAYS];
+    bool ok = true;
+
+    for (int s = 0; s < k; s++)
+        ok &= ext_next(ctx, &r[s]);
+    for (int t = 0; t < k; t++)
+        tree[t] = k;
+    for (int s = k - 1; s >= 0; s--)
+        ext_adjust(tree, r, k, s);
+
+    for (;;) {
+        struct ext_reader *src = &r[tree[0]];
+        element_t *e;
+
+        if (!src->cur)
+            break;
+
+        if (out) {
+            ctx->stats->spilled += ext_put(out, src->cur, src->len);
+        } else if (!src->file) {
+            e = list_entry(src->list, element_t, list);
+            src->list = src->list->next;
+            list_add_tail(&e->list, &ctx->q->head);
+            q_account_add(ctx->q, e);
+        } else if ((e = element_new(ctx->q, src->cur))) {
+            list_add_tail(&e->list, &ctx->q->head);
+            q_account_add(ctx->q, e);
+        } else {
+            ok = false;
+        }
 
-    list_for_each (li, head)
-        size++;
+        ok &= ext_next(ctx, src);
+        ext_adjust(tree, r, k, tree[0]);
+    }
 
-    return size;
+    return ok;
 }
 
-/* Delete the middle node in queue */
-// https://leetcode.com/problems/delete-the-middle-node-of-a-linked-list/
-bool q_delete_mid(struct list_head *head)
+/* Make room for one more run in ctx->runs */
+static bool ext_reserve(struct ext_sort *ctx)
 {
-    if (!head || list_empty(head))
+    if (ctx->nruns < ctx->cap)
+        return true;
+
+    size_t cap = ctx->cap ? ctx->cap * 2 : 16;
+    int *runs = ext_alloc(ctx, cap * sizeof(int));
+    if (!runs)
         return false;
+    if (ctx->nruns)
+        memcpy(runs, ctx->runs, ctx->nruns * sizeof(int));
+    ext_free(ctx, ctx->runs, ctx->cap * sizeof(int));
+    ctx->runs = runs;
+    ctx->cap = cap;
+    return true;
+}
 
-    struct list_head *pre = head->prev;
-    struct list_head *nex = head->next;
+/* Create a temporary file for writing through @iobuf */
+static FILE *ext_create(char *iobuf, size_t iosize)
+{
+    FILE *f = tmpfile();
 
-    // Find the middle of list
-    do {
-        pre = pre->prev;
-        nex = nex->next;
-    } while (pre != nex && pre != nex->next);
+    if (f && iobuf)
+        setvbuf(f, iobuf, _IOFBF, iosize);
+    return f;
+}
 
-    list_del(pre);
-    element_t *target = list_entry(pre, element_t, list);
-    q_release_element(target);
+/* Close the run written to @f, returning a descriptor to read it back or -1
+ * if it could not be written
+ */
+static int ext_commit(FILE *f)
+{
+    int fd = -1;
 
-    return true;
+    if (!fflush(f) && !ferror(f))
+        fd = dup(fileno(f));
+    fclose(f);
+    return fd;
 }
 
-/* Delete all nodes that have duplicate string */
-// https://leetcode.com/problems/remove-duplicates-from-sorted-list-ii/
-bool q_delete_dup(struct list_head *head)
+/* Write the sorted null-terminated list @list to a new run, for which
+ * ctx->runs has room
+ */
+static bool ext_spill(struct ext_sort *ctx,
+                      struct list_head *list,
+                      char *iobuf,
+                      size_t iosize)
 {
-    if (!head || list_empty(head))
-        return false;
+    FILE *f;
+    size_t spilled = 0;
 
-    bool dup = false;
-    element_t *target, *temp;
+    if (!(f = ext_create(iobuf, iosize)))
+        return false;
 
-    list_for_each_entry_safe (target, temp, head, list) {
-        if (target->list.next != head && !strcmp(target->value, temp->value)) {
-            dup = true;
-            list_del(&target->list);
-            q_release_element(target);
-        } else if (dup) {
-            dup = false;
-            list_del(&target->list);
-            q_release_element(target);
-        }
+    for (; list; list = list->next) {
+        const char *s = list_entry(list, element_t, list)->value;
+        spilled += ext_put(f, s, strlen(s));
     }
+    int fd = ext_commit(f);
+    if (fd < 0)
+        return false;
 
+    ctx->runs[ctx->nruns++] = fd;
+    ctx->stats->spilled += spilled;
+    ctx->stats->runs++;
     return true;
 }
 
-/* Swap every two adjacent nodes */
-// https://leetcode.com/problems/swap-nodes-in-pairs/
-/*
-void q_swap(struct list_head *head)
+/* Cut the queue into sorted runs of at most the budget, spilling each one
+ * and releasing its elements
+ */
+static void ext_make_runs(struct ext_sort *ctx)
 {
+    struct list_head *head = &ctx->q->head;
+    /* Runs are cut from the queue before any sampling could see it */
+    int algo = q_sort_algo == Q_SORT_AUTO ? Q_SORT_MERGE : q_sort_algo;
+    size_t iosize = EXT_BUFFER_MIN;
+    char *iobuf = ext_alloc(ctx, iosize);
+
+    while (!list_empty(head)) {
+        struct list_head *list = NULL, **link = &list, *tail;
+        size_t len = 0, bytes = 0;
+        bool room = ext_reserve(ctx);
+        size_t limit = ext_avail(ctx);
+
+        while (!list_empty(head)) {
+            element_t *e = list_first_entry(head, element_t, list);
+            size_t size = element_size(e);
+            if (len && bytes + size > limit)
+                break;
+            list_del(&e->list);
+            q_account_del(ctx->q, e);
+            *link = &e->list;
+            link = &e->list.next;
+            len++;
+            bytes += size;
+        }
+        *link = NULL;
+        ext_mem(ctx, bytes);
+
+        list = sort_list(list, len, algo, &tail);
+        if (!ctx->nruns && list_empty(head)) {
+            /* The whole queue fits in the budget */
+            ctx->rest = list;
+            break;
+        }
+        if (!room || !ext_spill(ctx, list, iobuf, iosize)) {
+            /* Keep this run and everything after it in memory */
+            while (!list_empty(head)) {
+                element_t *e = list_first_entry(head, element_t, list);
+                list_del(&e->list);
+                q_account_del(ctx->q, e);
+                tail->next = &e->list;
+                tail = &e->list;
+                len++;
+                ext_mem(ctx, element_size(e));
+            }
+            tail->next = NULL;
+            ctx->rest = sort_list(list, len, algo, &tail);
+            break;
+        }
 
-    struct list_head *node = NULL;
-    for (node = head->next; node != head && node->next != head;
-         node = node->next) {
-        struct list_head *next = node->next;
-        list_move_tail(node, next);
+        while (list) {
+            element_t *e = list_entry(list, element_t, list);
+            list = list->next;
+            q_release_element(e);
+        }
+        ext_mem(ctx, -(ptrdiff_t) bytes);
     }
+
+    ext_free(ctx, iobuf, iosize);
 }
-*/
 
-void q_swap(struct list_head *head)
+/* Merge the @k runs of ctx->runs from @i into a new run, returning its
+ * descriptor or -1.  The runs are read through duplicates of their
+ * descriptors, so that they are all still there if it could not be written.
+ */
+static int ext_merge_pass(struct ext_sort *ctx,
+                          struct ext_reader *r,
+                          size_t i,
+                          size_t k)
 {
-    if (!head || list_empty(head))
-        return;
-
-    q_reverseK(head, 2);
+    /* A buffer for each reader and one for the output */
+    size_t iosize = ext_iosize(ctx, k + 1);
+    char *iobuf = ext_alloc(ctx, iosize);
+    FILE *out = ext_create(iobuf, iosize);
+    bool ok = out;
+
+    memset(r, 0, k * sizeof(*r));
+    for (size_t j = 0; ok && j < k; j++) {
+        int fd = dup(ctx->runs[i + j]);
+        ok = fd >= 0 && ext_open(ctx, &r[j], fd, iosize);
+    }
+    if (ok)
+        ok = ext_merge(ctx, r, k, out);
+    for (size_t j = 0; j < k; j++)
+        ext_close(ctx, &r[j]);
+
+    int fd = out ? ext_commit(out) : -1;
+    if (!ok && fd >= 0) {
+        close(fd);
+        fd = -1;
+    }
+    ext_free(ctx, iobuf, iosize);
+    return fd;
 }
 
-/* Reverse elements in queue */
-void q_reverse(struct list_head *head)
+/* Take the elements back in the queue off it as a null-terminated list */
+static struct list_head *ext_take_queue(queue_t *q)
 {
-    element_t *entry, *safe;
-    list_for_each_entry_safe (entry, safe, head, list)
-        list_move(&entry->list, head);
+    struct list_head *list = q->head.next;
+    element_t *e;
+
+    list_for_each_entry (e, &q->head, list)
+        q_account_del(q, e);
+    q->head.prev->next = NULL;
+    INIT_LIST_HEAD(&q->head);
+    return list;
 }
 
-/* Reverse the nodes of the list k at a time */
-// https://leetcode.com/problems/reverse-nodes-in-k-group/
-void q_reverseK(struct list_head *head, int k)
+/* Merge the runs back into the queue through the @fan_in readers of @r.
+ *
+ * While there are more runs than readers, each pass merges consecutive
+ * groups of them into longer runs on disk, so that runs stay in queue order
+ * and ties keep going to the earlier one.  Once a run cannot be written, the
+ * runs are merged back into the queue a group at a time instead, the strings
+ * already back making up the first run of the next group.
+ */
+static bool ext_merge_runs(struct ext_sort *ctx,
+                           struct ext_reader *r,
+                           size_t fan_in)
 {
-    if (!head || list_empty(head) || k == 1)
-        return;
+    bool ok = true, stuck = false;
+
+    while (!stuck && ctx->nruns + !!ctx->rest > fan_in) {
+        size_t i = 0, w = 0;
+
+        while (i < ctx->nruns) {
+            size_t k = ctx->nruns - i < fan_in ? ctx->nruns - i : fan_in;
+            int fd = k > 1 && !stuck ? ext_merge_pass(ctx, r, i, k) : -1;
+
+            if (fd < 0) {
+                /* Out of temporary files: keep the runs for the merges below */
+                stuck |= k > 1;
+                ctx->runs[w++] = ctx->runs[i++];
+                continue;
+            }
+            for (size_t j = 0; j < k; j++)
+                close(ctx->runs[i++]);
+            ctx->runs[w++] = fd;
+            ctx->stats->merges++;
+        }
+        ctx->nruns = w;
+    }
 
-    struct list_head *node = NULL, *safe = NULL, *insert = head;
-    int count = 0;
+    struct list_head *rest = ctx->rest;
+    size_t i = 0;
 
-    list_for_each_safe (node, safe, head) {
-        if (k > count)
-            list_move(node, insert);
-        else {
-            count = 0;
-            insert = node->prev;
+    ctx->rest = NULL;
+    do {
+        size_t k = 0;
+
+        memset(r, 0, fan_in * sizeof(*r));
+        if (!list_empty(&ctx->q->head))
+            r[k++].list = ext_take_queue(ctx->q);
+        size_t n = ctx->nruns - i < fan_in - k ? ctx->nruns - i : fan_in - k;
+        size_t iosize = ext_iosize(ctx, n);
+        for (size_t j = 0; j < n; j++)
+            ok &= ext_open(ctx, &r[k++], ctx->runs[i++], iosize);
+        /* The run kept in memory comes last in the queue */
+        if (rest && i == ctx->nruns && k < fan_in) {
+            r[k++].list = rest;
+            rest = NULL;
         }
-        count++;
-    }
+
+        ok &= ext_merge(ctx, r, k, NULL);
+        for (size_t j = 0; j < k; j++)
+            ext_close(ctx, &r[j]);
+        ctx->stats->merges++;
+    } while (i < ctx->nruns || rest);
+
+    return ok;
 }
 
-/* Remove every node which has a node with a strictly greater value anywhere to
- * the right side of it */
-// https://leetcode.com/problems/remove-nodes-from-linked-list/
-int q_descend(struct list_head *head)
+/* Sort a queue through temporary files within a memory budget */
+bool q_sort_external(struct list_head *head,
+                     size_t budget,
+                     struct q_ext_stats *stats)
 {
-    if (!head || list_empty(head))
-        return 0;
-
-    int size = q_size(head);
-    struct list_head *target = head->prev, *prev = target->prev;
+    struct q_ext_stats local;
+    struct ext_sort ctx = {0};
 
-    while (target->prev != head) {
-        element_t *t = list_entry(target, element_t, list);
-        element_t *p = list_entry(prev, element_t, list);
+    if (!stats)
+        stats = &local;
+    memset(stats, 0, sizeof(*stats));
+    q_sort_cmps = 0;
 
-        if (strcmp(p->value, t->value) < 0) {
-            list_del(&p->list);
-            q_release_element(p);
-            prev = target->prev;
-            size--;
-        } else {
-            target = prev;
-            prev = target->prev;
-        }
-    }
+    if (!head || budget < Q_EXT_MIN_BUDGET)
+        return false;
+    if (list_empty(head) || list_is_singular(head))
+        return true;
+
+    q_straighten(head);
+    ctx.q = q_of(head);
+    ctx.q->mid = NULL;
+    ctx.q->sorted = false;
+    ctx.q->indexed = false;
+    ctx.q->ringed = false;
+    ctx.budget = budget;
+    ctx.stats = stats;
+
+    /* Readers for the merges, each with a buffer of EXT_BUFFER_MIN or more,
+     * taken first so that nothing is spilled if they cannot be had
+     */
+    size_t fan_in = budget / EXT_BUFFER_MIN - 2;
+    if (fan_in > MERGE_WAYS)
+        fan_in = MERGE_WAYS;
+    struct ext_reader *r = ext_alloc(&ctx, fan_in * sizeof(*r));
+    if (!r)
+        return false;
 
-    return size;
+    double start = clock_now();
+    ext_make_runs(&ctx);
+    double mid = clock_now();
+    bool ok = ext_merge_runs(&ctx, r, fan_in);
+    stats->run_time = mid - start;
+    stats->merge_time = clock_now() - mid;
+
+    ext_free(&ctx, r, fan_in * sizeof(*r));
+    ext_free(&ctx, ctx.runs, ctx.cap * sizeof(int));
+    ctx.q->sorted = ok;
+    return ok;
 }
 
-/* Merge two list*/
-static inline struct list_head *mergelist(struct list_head *l1,
-                                          struct list_head *l2)
+/* A candidate of q_topk(), ranked by its string and then its position */
+struct topk_entry {
+    element_t *e;
+    size_t pos;
+};
+
+/* Should @a be picked before @b? */
+static inline bool topk_better(const struct topk_entry *a,
+                               const struct topk_entry *b,
+                               int flags)
 {
-    struct list_head temp;
-    struct list_head *t = &temp;
+    q_sort_cmps++;
+    int c = element_cmp(a->e, b->e);
+    if (flags & Q_LARGEST)
+        c = -c;
+    return c < 0 || (c == 0 && a->pos < b->pos);
+}
 
-    while (l1 && l2) {
-        element_t *ele1 = list_entry(l1, element_t, list);
-        element_t *ele2 = list_entry(l2, element_t, list);
-        if (strcmp(ele1->value, ele2->value) < 0) {
-            t->next = l1;
-            t = t->next;
-            l1 = l1->next;
-        } else {
-            t->next = l2;
-            t = t->next;
-            l2 = l2->next;
-        }
+/* Sift @heap[i] down a heap of @n entries that keeps its worst entry on top */
+static void topk_sift(struct topk_entry *heap, size_t n, size_t i, int flags)
+{
+    struct topk_entry x = heap[i];
+
+    for (size_t child; (child = 2 * i + 1) < n; i = child) {
+        if (child + 1 < n && topk_better(&heap[child], &heap[child + 1], flags))
+            child++;
+        if (!topk_better(&x, &heap[child], flags))
+            break;
+        heap[i] = heap[child];
     }
-
-    // Connect the remain list
-    if (l1)
-        t->next = l1;
-    if (l2)
-        t->next = l2;
-
-    return temp.next;
+    heap[i] = x;
 }
 
-/* Merge sort*/
-static inline struct list_head *mergesort(struct list_head *head)
+/* Bring the k smallest (or largest) strings to the front of queue */
+int q_topk(struct list_head *head, int k, int flags)
 {
-    if (!head->next)
-        return head;
+    q_sort_cmps = 0;
+
+    if (!head || k < 0)
+        return 0;
 
-    struct list_head *fast = head->next;
-    struct list_head *slow = head;
+    q_straighten(head);
+    queue_t *q = q_of(head);
+    q->mid = NULL;
+    q->sorted = false;
+    q->indexed = false;
+    q->ringed = false;
+    size_t n = (size_t) k < (size_t) q->size ? (size_t) k : (size_t) q->size;
+    struct topk_entry *heap = NULL;
+
+    if (n) {
+        heap = malloc(n * sizeof(*heap));
+        if (!heap)
+            return -1;
+    }
 
-    // split list
-    while (fast && fast->next) {
-        slow = slow->next;
-        fast = fast->next->next;
+    size_t pos = 0;
+    struct list_head *node;
+    list_for_each (node, head) {
+        struct topk_entry x = {list_entry(node, element_t, list), pos++};
+        if (pos <= n) {
+            heap[pos - 1] = x;
+            if (pos == n) {
+                for (size_t i = n / 2; i-- > 0;)
+                    topk_sift(heap, n, i, flags);
+            }
+        } else if (n && topk_better(&x, &heap[0], flags)) {
+            heap[0] = x;
+            topk_sift(heap, n, 0, flags);
+        }
     }
 
-    // Fast is the middle of list
-    fast = slow->next;
-    slow->next = NULL;
+    /* Popping the worst entry each time leaves the best one at the front */
+    for (size_t m = n; m > 0; m--) {
+        list_move(&heap[0].e->list, head);
+        heap[0] = heap[m - 1];
+        topk_sift(heap, m - 1, 0, flags);
+    }
+    free(heap);
+
+    if (flags & Q_DISCARD) {
+        while (q->size > (int) n) {
+            element_t *e = list_last_entry(head, element_t, list);
+            list_del(&e->list);
+            q_account_del(q, e);
+            q_release_element(e);
+        }
+    }
 
-    struct list_head *left = mergesort(head);
-    struct list_head *right = mergesort(fast);
+    return n;
+}
 
-    // Merge sorted left and sorted right
-    return mergelist(left, right);
+/* Does @a rank before @b? */
+static inline int select_cmp(const element_t *a, const element_t *b, int flags)
+{
+    q_sort_cmps++;
+    int c = element_cmp(a, b);
+    return flags & Q_LARGEST ? -c : c;
 }
 
-/* Sort elements of queue in ascending order */
-void q_sort(struct list_head *head)
+static inline void select_swap(element_t **a, element_t **b)
 {
-    if (!head || list_empty(head))
-        return;
+    element_t *t = *a;
+    *a = *b;
+    *b = t;
+}
 
-    // Turn the list into Singly-linked list
-    head->prev->next = NULL;
-    head->next = mergesort(head->next);
+/* Find the element of rank @i in @arr[0..n) by quickselect with a
+ * median-of-three pivot and a three-way partition, so that runs of equal
+ * strings do not degrade it
+ */
+static element_t *quickselect(element_t **arr, size_t n, size_t i, int flags)
+{
+    size_t lo = 0, hi = n;
+
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (select_cmp(arr[mid], arr[lo], flags) < 0)
+            select_swap(&arr[mid], &arr[lo]);
+        if (select_cmp(arr[hi - 1], arr[mid], flags) < 0) {
+            select_swap(&arr[hi - 1], &arr[mid]);
+            if (select_cmp(arr[mid], arr[lo], flags) < 0)
+                select_swap(&arr[mid], &arr[lo]);
+        }
+        element_t *pivot = arr[mid];
+
+        /* arr[lo, lt) < pivot, arr[lt, j) == pivot, arr[gt, hi) > pivot */
+        size_t lt = lo, j = lo, gt = hi;
+        while (j < gt) {
+            int c = select_cmp(arr[j], pivot, flags);
+            if (c < 0)
+                select_swap(&arr[lt++], &arr[j++]);
+            else if (c > 0)
+                select_swap(&arr[j], &arr[--gt]);
+            else
+                j++;
+        }
 
-    // Turn the list into Doubly-linked list
-    struct list_head *temp = head, *next = head->next;
-    while (next) {
-        next->prev = temp;
-        temp = next;
-        next = next->next;
+        if (i < lt)
+            hi = lt;
+        else if (i >= gt)
+            lo = gt;
+        else
+            return arr[i];
     }
-    temp->next = head;
-    head->prev = temp;
+
+    return arr[lo];
 }
 
-/* Merge all the queues into one sorted queue, which is in ascending order */
-// https://leetcode.com/problems/merge-k-sorted-lists/
-int q_merge(struct list_head *head)
+/* Find the string of rank i in queue */
+element_t *q_select(struct list_head *head, int i, int flags)
 {
-    if (!head || list_empty(head))
-        return 0;
+    q_sort_cmps = 0;
 
-    queue_contex_t *cur = list_entry(head->next, queue_contex_t, chain);
+    if (!head || i < 0 || i >= q_of(head)->size)
+        return NULL;
 
-    for (struct list_head *temp = head->next->next; temp != head;
-         temp = temp->next) {
-        queue_contex_t *t = list_entry(temp, queue_contex_t, chain);
-        list_splice_init(t->q, cur->q);
+    queue_t *q = q_of(head);
+    element_t **arr = malloc(q->size * sizeof(*arr));
+    if (!arr)
+        return NULL;
+
+    size_t n = 0;
+    element_t *e, *safe;
+    q_link(q);
+    list_for_each_entry (e, head, list)
+        arr[n++] = e;
+    element_t *picked = quickselect(arr, n, i, flags);
+    free(arr);
+
+    if (flags & Q_DISCARD) {
+        q->mid = NULL;
+        q->sorted = true;
+        q->indexed = false;
+        q->ringed = false;
+        list_for_each_entry_safe (e, safe, head, list) {
+            if (e == picked)
+                continue;
+            list_del(&e->list);
+            q_account_del(q, e);
+            q_release_element(e);
+        }
     }
 
-    q_sort(cur->q);
-    return q_size(cur->q);
-}
\ No newline at end of file
+    return picked;
+}
@@ -9,22 +9,181 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
+#include "counters.h"
 #include "harness.h"
 #include "list.h"
 
+/* Cache the first bytes of each string in its element unless built with
+ * KEY_PREFIX=0
+ */
+#ifndef KEY_PREFIX
+#define KEY_PREFIX 1
+#endif
+
+/* Code the comparison prefix at 5 bits per lowercase letter when built with
+ * KEY_PACK=1
+ */
+#ifndef KEY_PACK
+#define KEY_PACK 0
+#endif
+#if KEY_PACK && !KEY_PREFIX
+#error "KEY_PACK=1 needs the key prefix"
+#endif
+
 /**
  * element_t - Linked list element
  * @value: pointer to array holding string
  * @list: node of a doubly-linked list
+ * @pool: slab pool the element was carved from, NULL if it was malloc'ed
+ * @key: first 8 bytes of the string as a big-endian integer, zero padded
+ * @data: inline storage for the string
+ *
+ * Elements created by the queue operations allocate the node and the string
+ * in a single block, with @value pointing at @data.  Short strings are padded
+ * up to ELEMENT_SMALL_SIZE bytes so that they all share one allocation size.
+ * In a queue created under q_intern_mode, @value points at a string shared
+ * with every element of the same value instead, and @data is empty.
+ * Comparing two @key values orders the strings as strcmp() does on their
+ * first 8 bytes.
  *
- * @value needs to be explicitly allocated and freed
+ * Under KEY_PACK, @key holds the string in an order-preserving code instead,
+ * 5 bits per lowercase letter and 11 or 12 bits per other byte, in its top
+ * 60 bits.  The low 4 bits hold the number of bytes coded in full, or 15 if
+ * the code ends inside the key, so that equal keys always agree on them.
+ * A string of up to 11 lowercase letters is then decided by the key alone,
+ * against 7 bytes of any kind for the plain prefix.  Only comparisons
+ * change: the strings are stored as they are either way.
  */
 typedef struct {
     char *value;
     struct list_head list;
+    struct q_pool *pool;
+#if KEY_PREFIX
+    uint64_t key;
+#endif
+    char data[];
 } element_t;
 
+/* Allocation size of an element whose string fits in the small-string class */
+#define ELEMENT_SMALL_SIZE 64
+
+/**
+ * queue_t - Header of a queue created by q_new()
+ * @head: list head handed out to callers, must stay the first member
+ * @size: the number of elements linked into @head
+ * @bytes: the total bytes of string storage held by the elements
+ * @pool: slab pool for new elements, NULL unless created under q_pool_mode
+ * @pooled: the number of elements in @head that were carved from @pool
+ * @reversed: the queue reads from @head.prev back to @head.next
+ * @mid: node at index size / 2 in reading order, NULL if empty or unknown
+ * @sorted: the list is known to ascend from @head.next to @head.prev
+ * @index: skip-list index of the list, NULL until q_insert_sorted() needs it
+ * @indexed: @index is up to date with the list
+ * @ring: ring index, an array of the elements in list order, NULL unless
+ *        created under q_pool_mode 3
+ * @ringed: @ring is up to date with the list
+ * @chunks: the elements in chunks of element pointers, in list order, NULL
+ *          unless created under q_pool_mode 4
+ * @chunked: @chunks holds every element of the queue
+ * @linked: the list links every element of the queue
+ * @intern: table of the strings of new elements, NULL unless created under
+ *          q_intern_mode
+ *
+ * Callers only ever see &queue->head.  Every q_* operation recovers the
+ * header with list_entry(), so @size and @bytes are kept up to date by
+ * each insert, remove, delete and merge path and q_size() is O(1).
+ *
+ * q_reverse() only flips @reversed.  The head and tail operations, q_first(),
+ * q_last() and q_next() read the list in the direction it gives, q_sort()
+ * and q_delete_dup() do not depend on it, and the other operations first
+ * turn the links around with q_straighten().
+ *
+ * The head and tail operations, q_reverse() and q_delete_mid() move @mid by
+ * at most one node.  Operations that relink the queue otherwise leave it
+ * unknown, and the next q_delete_mid() walks to the middle to find it again.
+ *
+ * @sorted is about the links, not the reading order, so that q_reverse()
+ * keeps it and a q_sort() after it only has to clear @reversed.  It is set by
+ * the sorts and q_merge(), kept by removals, by inserts in order with the
+ * neighbouring element and by q_delete_mid(), q_delete_dup() and
+ * q_descend(), and cleared by everything else that relinks the queue.
+ *
+ * @index is built by q_insert_sorted() over a sorted queue and kept through
+ * the head and tail operations for as long as @sorted holds.  Any other
+ * operation that unlinks or moves nodes only clears @indexed, since some of
+ * them run where freeing is not allowed; the stale nodes are freed when the
+ * index is rebuilt or the queue freed.
+ *
+ * @ring is a cache of the list, not a storage of its own: the list still
+ * links every element, and the ring costs memory and an update on top of it.
+ * It is a power-of-two circular array that the head and tail operations keep
+ * in step with the list in O(1), doubling it as the queue grows so that it
+ * always has two slots per element.  q_sort() then merge sorts the array,
+ * with its free half as the buffer, and q_reverseK() and so q_swap() reverse
+ * groups in it, and both link the list again after it.  The other operations
+ * that relink the queue, q_reverse() aside, only clear @ringed, and the next
+ * sort reads the list back into the array.
+ *
+ * @chunks is a storage of its own: the head and tail operations only push
+ * and pop element pointers at the ends of the chunks, in O(1), and leave the
+ * nodes of the elements unlinked.  @head.next and @head.prev still point at
+ * the first and the last element in list order, so that list_empty(),
+ * q_first() and q_last() hold, and q_walk() reads the chunks.  Every other
+ * operation that reads the nodes first links the list after the chunks, in
+ * O(n) once after a run of head and tail operations, and leaves the chunks
+ * stale without freeing them; the next insert at the head or the tail reads
+ * the list back into them.  Without memory for a chunk the queue stays on
+ * its list until it is linked again.  A queue of any other storage is always
+ * @linked.
+ */
+typedef struct {
+    struct list_head head;
+    int size;
+    size_t bytes;
+    struct q_pool *pool;
+    int pooled;
+    bool reversed;
+    struct list_head *mid;
+    bool sorted;
+    struct q_skip *index;
+    bool indexed;
+    struct q_ring *ring;
+    bool ringed;
+    struct q_chunks *chunks;
+    bool chunked;
+    bool linked;
+    struct q_intern *intern;
+} queue_t;
+
+/*
+ * When non-zero, q_new() gives the queue its own slab pool.  Small-string
+ * elements are then carved from large slabs allocated with test_malloc() and
+ * recycled through a free list, and q_free() releases them a slab at a time.
+ * Removed elements keep the pool alive until they are released, so a leaked
+ * element still shows up in the allocation check.
+ *
+ * At 1, every element of the pool takes ELEMENT_SMALL_SIZE bytes.  At 2, the
+ * pool is compact: it takes elements of up to 256 bytes, each in its own size
+ * rounded up to 8 bytes, and keeps a free list per size.  At 3, the pool is
+ * compact and the queue also keeps a ring index of its elements, see
+ * queue_t.  At 4, the pool is compact and the queue is stored in chunks of
+ * element pointers, see queue_t.
+ */
+extern int q_pool_mode;
+
+/*
+ * When non-zero, q_new() gives the queue its own intern table.  Each new
+ * element then points at the one copy of its string in the table, which
+ * counts the elements using it and is freed with the last of them.  A freed
+ * queue leaves its table behind until the elements it created that were
+ * removed or merged away are released.  Equal strings then compare equal on
+ * the pointer.
+ */
+extern int q_intern_mode;
+
 /**
  * queue_contex_t - The context managing a chain of queues
  * @q: pointer to the head of the queue
@@ -44,6 +203,9 @@ typedef struct {
 /**
  * q_new() - Create an empty queue whose next and prev pointer point to itself
  *
+ * The returned list head is embedded in a queue_t header, so it must only be
+ * released with q_free().
+ *
  * Return: NULL for allocation failed
  */
 struct list_head *q_new();
@@ -78,6 +240,22 @@ bool q_insert_head(struct list_head *head, char *s);
  */
 bool q_insert_tail(struct list_head *head, char *s);
 
+/**
+ * q_insert_sorted() - Insert an element in ascending order
+ * @head: header of queue
+ * @s: string would be inserted
+ *
+ * The new element goes after those less than or equal to it.  The insertion
+ * point is found with a skip-list index built over the list on first use, in
+ * O(log n) expected comparisons; building it costs one walk of the list.
+ * The queue must be known to be sorted, see q_sorted(): it is never sorted
+ * here.
+ *
+ * Return: true for success, false for allocation failed, queue is NULL or
+ * not known to be sorted
+ */
+bool q_insert_sorted(struct list_head *head, char *s);
+
 /**
  * q_remove_head() - Remove the element from head of queue
  * @head: header of queue
@@ -112,22 +290,59 @@ element_t *q_remove_tail(struct list_head *head, char *sp, size_t bufsize);
  * q_release_element() - Release the element
  * @e: element would be released
  *
+ * The string is stored inline, so the element is released with one free, or
+ * handed back to the free list of the pool it was carved from.
  * This function is intended for internal use only.
  */
-static inline void q_release_element(element_t *e)
-{
-    test_free(e->value);
-    test_free(e);
-}
+void q_release_element(element_t *e);
 
 /**
  * q_size() - Get the size of the queue
  * @head: header of queue
  *
+ * The size is tracked by the queue header, so this runs in constant time.
+ *
  * Return: the number of elements in queue, zero if queue is NULL or empty
  */
 int q_size(struct list_head *head);
 
+/**
+ * q_footprint() - Get the memory held by the queue
+ * @head: header of queue
+ *
+ * Counts the header, the slabs of its pool, its skip-list and ring indexes,
+ * its chunks, its intern table with the strings in it and the elements
+ * allocated on their own, each the size glibc rounds it up to.  The
+ * bookkeeping of the test harness is left out.  Walks the queue unless all
+ * of its elements come from its pool, and the intern table if it has one.
+ *
+ * Return: the number of bytes, zero if queue is NULL
+ */
+size_t q_footprint(struct list_head *head);
+
+/**
+ * struct q_intern_stats - State of the intern table of a queue
+ * @strings: distinct strings in the table
+ * @refs: elements pointing at them, in this queue or any other
+ * @bytes: bytes of the strings themselves
+ * @saved: string bytes the elements would hold beyond @bytes without the
+ *         table, one copy per element
+ * @overhead: bytes of the table, its buckets and the headers of its strings,
+ *            as glibc rounds them up
+ */
+struct q_intern_stats {
+    size_t strings, refs, bytes, saved, overhead;
+};
+
+/**
+ * q_intern_stats() - Report on the intern table of the queue
+ * @head: header of queue
+ * @st: filled in if not NULL, walking the table
+ *
+ * Return: true if the queue has an intern table, false if not or NULL
+ */
+bool q_intern_stats(struct list_head *head, struct q_intern_stats *st);
+
 /**
  * q_delete_mid() - Delete the middle node in queue
  * @head: header of queue
@@ -136,6 +351,9 @@ int q_size(struct list_head *head);
  * ⌊n / 2⌋th node from the start using 0-based indexing.
  * If there're six elements, the third member should be returned.
  *
+ * The queue keeps track of its middle node, so this takes constant time
+ * unless the queue was relinked since the middle node was last known.
+ *
  * Reference:
  * https://leetcode.com/problems/delete-the-middle-node-of-a-linked-list/
  *
@@ -171,10 +389,88 @@ void q_swap(struct list_head *head);
  * No effect if queue is NULL or empty.
  * This function should not allocate or free any list elements
  * (e.g., by calling q_insert_head, q_insert_tail, or q_remove_head).
- * It should rearrange the existing ones.
+ * It flips the direction the queue is read in, in O(1), and leaves the links
+ * to q_straighten().
  */
 void q_reverse(struct list_head *head);
 
+/**
+ * q_straighten() - Carry out the reversal q_reverse() left pending
+ * @head: header of queue
+ *
+ * Links the list of a chunked queue, then turns the links of every node
+ * around, so that walking @head.next first reads the queue in order again.
+ * Code that walks the list with the plain list.h helpers calls it first.  No
+ * effect if queue is NULL, or linked and not reversed.
+ */
+void q_straighten(struct list_head *head);
+
+/**
+ * q_relinked() - Note that the nodes of a queue were relinked
+ * @head: header of queue
+ * @sorted: the list now ascends from head->next, as q_sort() leaves it
+ *
+ * For code that reorders a queue with the plain list.h helpers, after
+ * q_straighten(): the queue forgets its middle node, which the next
+ * q_delete_mid() finds again, whether it was sorted unless @sorted says so,
+ * and its chunks.
+ */
+void q_relinked(struct list_head *head, bool sorted);
+
+/**
+ * q_walk() - Call a function on each element of queue in reading order
+ * @head: header of queue
+ * @fn: function called with each element and @arg, false to stop the walk
+ * @arg: passed to @fn
+ *
+ * Reads the chunks of a chunked queue while they are up to date, so that its
+ * list need not be linked, and the list otherwise.  @fn must not change the
+ * queue.
+ *
+ * Return: the number of elements @fn was called on, zero if queue is NULL
+ */
+int q_walk(struct list_head *head, bool (*fn)(element_t *, void *), void *arg);
+
+/* Is queue @head known to ascend in reading order, as after q_sort()? */
+static inline bool q_sorted(struct list_head *head)
+{
+    const queue_t *q = list_entry(head, queue_t, head);
+    return q->sorted && (!q->reversed || q->size < 2);
+}
+
+/* Is queue @head read backwards, from head->prev? */
+static inline bool q_reversed(struct list_head *head)
+{
+    return list_entry(head, queue_t, head)->reversed;
+}
+
+/* Does the list of queue @head link its elements, which a chunked queue
+ * leaves to q_straighten()?
+ */
+static inline bool q_linked(struct list_head *head)
+{
+    return list_entry(head, queue_t, head)->linked;
+}
+
+/* First node of queue @head in reading order, or @head if it is empty */
+static inline struct list_head *q_first(struct list_head *head)
+{
+    return q_reversed(head) ? head->prev : head->next;
+}
+
+/* Last node of queue @head in reading order, or @head if it is empty */
+static inline struct list_head *q_last(struct list_head *head)
+{
+    return q_reversed(head) ? head->next : head->prev;
+}
+
+/* Node after @node of queue @head in reading order, @head after the last */
+static inline struct list_head *q_next(struct list_head *head,
+                                       struct list_head *node)
+{
+    return q_reversed(head) ? node->prev : node->next;
+}
+
 /**
  * q_reverseK() - Given the head of a linked list, reverse the nodes of the list
  * k at a time, and return the modified list.
@@ -194,11 +490,260 @@ void q_reverseK(struct list_head *head, int k);
  * q_sort() - Sort elements of queue in ascending order
  * @head: header of queue
  *
+ * The sort is stable whichever engine q_sort_algo selects.  The default merge
+ * engine runs in linear time on input that is already sorted in either
+ * direction.  Q_SORT_AUTO samples the front of the queue and picks an engine
+ * for it; q_sort_stats tells which one sorted it.  A queue known to be sorted
+ * already, or reversed after it was sorted, takes constant time.
+ * A queue with a ring index is sorted on it with Q_SORT_RING, on the calling
+ * thread, unless a q_merge() into it outgrew the ring.
+ *
  * No effect if queue is NULL or empty. If there has only one element, do
  * nothing.
  */
 void q_sort(struct list_head *head);
 
+/* Number of string comparisons made by the most recent q_sort(), including
+ * those made by its helper threads, or by the most recent q_topk(),
+ * q_select(), q_sort_external() or q_insert_sorted()
+ */
+extern __thread size_t q_sort_cmps;
+
+/* Number of element_cmp() calls whose key prefixes tied, so that the
+ * strings had to be compared.  Reset by the caller.
+ */
+extern __thread size_t q_key_ties;
+
+/* strcmp(), also counting the bytes it reads under Q_STATS */
+static inline int element_strcmp(const char *s1, const char *s2)
+{
+#if Q_STATS
+    size_t n = 0;
+    while (s1[n] && s1[n] == s2[n])
+        n++;
+    Q_COUNT(bytes, 2 * (n + 1));
+#endif
+    return strcmp(s1, s2);
+}
+
+/**
+ * element_cmp() - Compare the strings of two queue elements
+ * @a: element created by the queue operations
+ * @b: element created by the queue operations
+ *
+ * Most comparisons are decided by the key prefixes alone.  When they tie and
+ * the strings are longer than the prefix, strcmp() resumes after it.
+ *
+ * Return: less than, equal to or greater than zero as strcmp() does
+ */
+static inline int element_cmp(const element_t *a, const element_t *b)
+{
+#if KEY_PREFIX
+    Q_COUNT(bytes, 2 * sizeof(a->key));
+    if (a->key != b->key)
+        return a->key < b->key ? -1 : 1;
+    q_key_ties++;
+#if KEY_PACK
+    /* Strings that ended inside the key are equal, and so are interned
+     * strings that are the same
+     */
+    if ((a->key & 0xf) == 0xf || a->value == b->value)
+        return 0;
+    return element_strcmp(a->value + (a->key & 0xf),
+                          b->value + (a->key & 0xf));
+#else
+    /* A zero last byte means both strings ended inside the prefix, and
+     * interned strings are equal if they are the same
+     */
+    if (!(a->key & 0xff) || a->value == b->value)
+        return 0;
+    return element_strcmp(a->value + sizeof(a->key),
+                          b->value + sizeof(b->key));
+#endif
+#else
+    if (a->value == b->value)
+        return 0;
+    return element_strcmp(a->value, b->value);
+#endif
+}
+
+/**
+ * element_prefetch_next() - Advance a prefetch cursor over queue elements
+ * @ahead: cursor returned by list_prefetch_ahead() or element_prefetch_next()
+ * @head: header of queue
+ *
+ * Like list_prefetch_next(), but also prefetches the string of the element
+ * the cursor leaves, whose node has had a step to arrive by now.  Only the
+ * part past the key prefix is fetched, since the prefix shares a cache line
+ * with the node.
+ *
+ * Return: the node after @ahead, or @head if @ahead already reached it
+ */
+static inline struct list_head *element_prefetch_next(struct list_head *ahead,
+                                                      struct list_head *head)
+{
+    if (ahead == head)
+        return head;
+    list_prefetch(list_entry(ahead, element_t, list)->value +
+                  KEY_PREFIX * sizeof(uint64_t));
+    return list_prefetch_next(ahead, head);
+}
+
+/**
+ * q_for_each_safe_prefetch - Iterate over queue elements, allow deletes and
+ *                            prefetch the elements and strings ahead
+ * @entry: element_t pointer used as iterator
+ * @safe: element_t pointer used to store info for next element in queue
+ * @ahead: list_head pointer used as prefetch cursor
+ * @head: header of queue
+ *
+ * As list_for_each_entry_safe_prefetch() with element_prefetch_next().
+ */
+#define q_for_each_safe_prefetch(entry, safe, ahead, head)                  \
+    for (entry = list_entry((head)->next, element_t, list),                  \
+        safe = list_entry(entry->list.next, element_t, list),                \
+        ahead = list_prefetch_ahead(&entry->list, head);                     \
+         &entry->list != (head); entry = safe,                               \
+        safe = list_entry(safe->list.next, element_t, list),                 \
+        ahead = element_prefetch_next(ahead, head))
+
+/* Sort engines of q_sort(), selected by q_sort_algo */
+enum {
+    Q_SORT_MERGE, /* natural merge sort on string comparisons */
+    Q_SORT_RADIX, /* MSD radix sort on string bytes, merge sort on small
+                   * buckets */
+    Q_SORT_LIST,  /* list_sort(), bottom-up merge sort on string comparisons */
+    Q_SORT_AUTO,  /* one of the above, picked from a sample of the queue */
+    Q_SORT_RING,  /* merge sort of the ring of a queue that has one, whatever
+                   * q_sort_algo says */
+};
+extern int q_sort_algo;
+
+/**
+ * struct q_sort_stats - How the most recent q_sort() went about it
+ * @algo: the engine that sorted the queue, never Q_SORT_AUTO
+ * @sampled: the number of elements Q_SORT_AUTO sampled, zero if it did not
+ * @pairs: the number of neighbours Q_SORT_AUTO compared
+ * @descents: neighbours found out of order, one per run boundary
+ * @dups: sampled elements equal to the next one in the sorted sample
+ * @key_len: average string length in the sample
+ * @prefix: average length of the prefix that neighbours in the sorted
+ *          sample share
+ * @alphabet: the number of distinct bytes in the sampled strings
+ * @depth: estimated number of bytes the radix engine has to look at
+ * @sample_time: seconds Q_SORT_AUTO took to sample and decide
+ * @presorted: the queue was known to be sorted and left as it was
+ *
+ * Comparisons made while sampling count towards q_sort_cmps.
+ */
+struct q_sort_stats {
+    int algo;
+    bool presorted;
+    size_t sampled, pairs, descents, dups, alphabet;
+    double key_len, prefix, depth;
+    double sample_time;
+};
+extern struct q_sort_stats q_sort_stats;
+
+/*
+ * Maximum number of threads q_sort() may use.  Large queues are cut into
+ * one segment per thread, sorted concurrently with the engine chosen by
+ * q_sort_algo and merged back in parallel.  Queues too small to give each
+ * thread a worthwhile share are sorted on the calling thread.
+ */
+extern int q_sort_threads;
+
+/**
+ * struct q_ext_stats - What q_sort_external() did
+ * @runs: the number of sorted runs spilled to temporary files
+ * @merges: the number of merges, the last one back into the queue
+ * @spilled: the number of bytes written to temporary files
+ * @peak: peak working memory in bytes, not counting the queue itself.  It
+ *        may exceed the budget by the size of the longest strings.
+ * @run_time: seconds spent cutting, sorting and spilling runs
+ * @merge_time: seconds spent merging the runs back
+ */
+struct q_ext_stats {
+    size_t runs;
+    size_t merges;
+    size_t spilled;
+    size_t peak;
+    double run_time;
+    double merge_time;
+};
+
+/* Smallest memory budget q_sort_external() accepts */
+#define Q_EXT_MIN_BUDGET 16384
+
+/**
+ * q_sort_external() - Sort a queue through temporary files
+ * @head: header of queue
+ * @budget: cap in bytes on the working memory of the sort
+ * @stats: filled with what the sort did, may be NULL
+ *
+ * Elements are cut off the front of the queue into runs of at most @budget
+ * bytes, each run is sorted in memory and written to a temporary file as
+ * length-prefixed strings, and its elements are released.  The runs are
+ * then merged back into the queue, a string at a time, through buffers that
+ * share the budget; when there are too many runs for that, groups of them
+ * are first merged into longer runs on disk.  A queue that fits in the
+ * budget is sorted in memory without touching the disk.
+ *
+ * If a temporary file cannot be written, the rest of the queue is sorted in
+ * memory and merged as one more run, which may exceed the budget.  If a
+ * merge on disk cannot be written, the runs are kept and merged back into
+ * the queue a group at a time, which reads the strings already back once
+ * more for each group.  Strings that cannot be read back, or whose element
+ * cannot be allocated, are lost.
+ *
+ * Return: true if every string is back in the queue in ascending order,
+ * false if the budget is below Q_EXT_MIN_BUDGET or something failed.
+ */
+bool q_sort_external(struct list_head *head,
+                     size_t budget,
+                     struct q_ext_stats *stats);
+
+/* Flags of q_topk() and q_select() */
+enum {
+    Q_LARGEST = 1 << 0, /* rank from the largest string down */
+    Q_DISCARD = 1 << 1, /* release the elements that were not picked */
+};
+
+/**
+ * q_topk() - Bring the smallest strings to the front of queue
+ * @head: header of queue
+ * @k: the number of strings wanted
+ * @flags: Q_LARGEST for the largest strings instead, Q_DISCARD to release
+ *         the other elements
+ *
+ * A bounded heap of @k elements is kept over a single pass on the queue, so
+ * the cost is O(n log k) comparisons rather than the O(n log n) of a sort.
+ * The picked elements end up at the front in ascending order, or descending
+ * with Q_LARGEST; the rest follow in their original order unless discarded.
+ * Equal strings keep their relative order, and among them the earlier ones
+ * are picked first.
+ *
+ * Return: the number of elements picked, min(@k, size), or -1 if the heap
+ * could not be allocated, in which case queue is left unchanged
+ */
+int q_topk(struct list_head *head, int k, int flags);
+
+/**
+ * q_select() - Find the string of a given rank in queue
+ * @head: header of queue
+ * @i: the rank counted from 0, the smallest string, or the largest with
+ *     Q_LARGEST
+ * @flags: Q_LARGEST and Q_DISCARD as for q_topk()
+ *
+ * Quickselect over an array of pointers to the elements takes O(n)
+ * comparisons on average.  Queue keeps its order; with Q_DISCARD every other
+ * element is released.
+ *
+ * Return: an element holding the string of rank @i, or NULL if queue is NULL,
+ * @i is out of range or the array could not be allocated
+ */
+element_t *q_select(struct list_head *head, int i, int flags);
+
 /**
  * q_descend() - Remove every node which has a node with a strictly greater
  * value anywhere to the right side of it.
@@ -221,6 +766,8 @@ int q_descend(struct list_head *head);
  *
  * This function merge the second to the last queues in the chain into the first
  * queue. The queues are guaranteed to be sorted before this function is called.
+ * Those not known to be sorted are sorted first, in linear time for a queue
+ * that is sorted after all.
  * No effect if there is only one queue in the chain. Allocation is disallowed
  * in this function. There is no need to free the 'qcontext_t' and its member
  * 'q' since they will be released externally. However, q_merge() is responsible
@@ -0,0 +1,396 @@
+#!/usr/bin/env python3
+
+from __future__ import print_function
+import getopt
+import os
+import random
+import re
+import subprocess
+import sys
+import tempfile
+
+
+# Benchmarks built from qtest command scripts
+class Bench:
+
+    qtest = "./qtest"
+    size = 262144
+    threads = os.cpu_count() or 1
+
+    header = ["option fail 0", "option malloc 0", "option bench 1"]
+
+    def __init__(self, qtest="", size=0, threads=0, base=""):
+        if qtest != "":
+            self.qtest = qtest
+        self.base = base or self.qtest
+        if size > 0:
+            self.size = size
+        if threads > 0:
+            self.threads = threads
+
+    # Run a command script and return (comparisons, ns/element) of each
+    # sort, merge, selection or sorted insert reported by 'option bench'
+    def runScript(self, cmds, prog=""):
+        out = self.runOutput(cmds, prog)
+        return [(int(c), float(t)) for c, t in re.findall(
+            r"(?:Sorted|Merged|Selected|Inserted) \d+ elements: (\d+) "
+            r"comparisons, "
+            r"([0-9.]+) ns/element", out)]
+
+    # Run a command script and return the seconds reported by each 'time'
+    def runTimes(self, cmds, prog=""):
+        out = self.runOutput(cmds, prog)
+        return [float(t) for t in re.findall(r"Delta time = ([0-9.]+)", out)]
+
+    def runOutput(self, cmds, prog=""):
+        with tempfile.NamedTemporaryFile("w", suffix=".cmd",
+                                         delete=False) as f:
+            f.write("\n".join(self.header + cmds + ["quit"]) + "\n")
+            fname = f.name
+        try:
+            out = subprocess.run([prog or self.qtest, "-v", "1", "-f", fname],
+                                 stdout=subprocess.PIPE,
+                                 universal_newlines=True).stdout
+        finally:
+            os.unlink(fname)
+        for line in out.splitlines():
+            if "ERROR" in line:
+                print(line)
+        return out
+
+    # k-way merge of sorted queues holding size elements in total
+    def merge(self):
+        print("%6s %10s %12s %12s" % ("k", "elements", "comparisons",
+                                      "ns/element"))
+        k = 2
+        while k <= 1024:
+            cmds = []
+            for _ in range(k):
+                cmds += ["new", "ih RAND %d" % (self.size // k), "sort"]
+            cmds += ["merge", "free"]
+            cmps, ns = self.runScript(cmds)[-1]
+            print("%6d %10d %12d %12.1f" % (k, self.size // k * k, cmps, ns))
+            k *= 2
+
+    # q_sort of size random strings on 1, 2, 4, ... threads
+    def threads(self):
+        print("%8s %10s %12s %12s %8s" % ("threads", "elements",
+                                          "comparisons", "ns/element",
+                                          "speedup"))
+        base = 0
+        t = 1
+        while True:
+            cmds = ["option threads %d" % t, "new",
+                    "ih RAND %d" % self.size, "sort", "free"]
+            cmps, ns = self.runScript(cmds)[-1]
+            base = base or ns
+            print("%8d %10d %12d %12.1f %7.2fx" % (t, self.size, cmps, ns,
+                                                   base / ns))
+            if t >= self.threads:
+                break
+            t = min(t * 2, self.threads)
+
+    # Top-k and selection against sort-then-walk for k much smaller than size
+    def topk(self):
+        print("%8s %22s %22s %22s" % ("k", "sort cmps     ns/elt",
+                                      "topk cmps     ns/elt",
+                                      "select cmps     ns/elt"))
+        for k in [1, 10, 100, 1000, 10000]:
+            if k >= self.size:
+                break
+            cmds = []
+            for op in ["sort", "topk %d" % k, "select %d" % (k - 1)]:
+                cmds += ["new", "ih RAND %d" % self.size, op, "free"]
+            res = self.runScript(cmds)
+            print("%8d" % k + "".join(" %12d %9.1f" % r for r in res))
+
+    # Batches of q_insert_sorted into a sorted queue of size elements against
+    # inserting each batch at the tail and sorting again, with the totals over
+    # size / 256 insertions.  The time of the tail inserts is left out.
+    def insert(self):
+        total = max(self.size // 256, 1)
+        print("%8s %22s %22s" % ("batch", "sort cmps     ns/ins",
+                                 "is cmps     ns/ins"))
+        b = 1
+        while b <= total:
+            rounds = total // b
+            line = "%8d" % b
+            for ops in [["it RAND %d" % b, "sort"], ["is RAND %d" % b]]:
+                cmds = ["new", "ih RAND %d" % self.size, "sort",
+                        "is RAND 1"] + ops * rounds + ["free"]
+                # The setup sort and the insert that builds the index
+                res = self.runScript(cmds)[2:]
+                n = b if len(ops) == 1 else self.size + b
+                line += " %12d %9.1f" % (
+                    sum(c for c, _ in res),
+                    sum(ns * n for _, ns in res) / (b * rounds))
+            print(line)
+            b *= 4
+
+    # Each storage of 'new' filled at the tail, walked by 'show' and freed,
+    # in ns/element, with the memory 'mem' reports.  Best of three.
+    def storage(self):
+        n = self.size
+        cmds = ["it RAND %d" % n, "mem", "time", "it dolphin %d" % n,
+                "time", "show", "time", "free", "time"]
+        print("%9s %10s %10s %10s %12s" % ("storage", "fill ns", "show ns",
+                                           "free ns", "bytes/elt"))
+        for storage in ["malloc", "slab", "compact", "ringindex", "chunk"]:
+            best = None
+            for _ in range(3):
+                out = self.runOutput(["new %s" % storage] + cmds)
+                times = [float(t) * 1e9 / n for t in
+                         re.findall(r"Delta time = ([0-9.]+)", out)][-3:]
+                best = [min(a, b) for a, b in zip(best or times, times)]
+            mem = float(re.findall(r"([0-9.]+) bytes/element", out)[-1])
+            print("%9s %10.1f %10.1f %10.1f %12.1f" % (storage, best[0],
+                                                       best[1], best[2], mem))
+
+    # Queues filled as trace-14 does, with two strings over and over, and with
+    # random strings, with and without an intern table: fill, dedup and free
+    # in ns/element, with the memory 'mem' reports.  Best of three.  The
+    # random fill comes in four commands to stay within the time limit.
+    def intern(self):
+        n = self.size
+        inputs = [("dups", ["ih dolphin %d" % (n // 2),
+                            "it gerbil %d" % (n - n // 2)], []),
+                  ("random", ["ih RAND %d" % (n // 4)] * 4, ["sort"])]
+        print("%8s %16s %10s %10s %10s %12s" % ("input", "storage", "fill ns",
+                                                "dedup ns", "free ns",
+                                                "bytes/elt"))
+        for name, fill, prep in inputs:
+            for storage in ["malloc", "malloc intern", "compact",
+                            "compact intern"]:
+                cmds = ["new %s" % storage, "time"] + fill + ["time"] + prep
+                cmds += ["mem", "time", "dedup", "time", "free", "time"]
+                best = None
+                for _ in range(3):
+                    out = self.runOutput(cmds)
+                    times = [float(t) * 1e9 / (n // 4 * 4) for t in
+                             re.findall(r"Delta time = ([0-9.]+)", out)]
+                    times = [times[-4], times[-2], times[-1]]
+                    best = [min(a, b) for a, b in zip(best or times, times)]
+                mem = float(re.findall(r"([0-9.]+) bytes/element", out)[-1])
+                print("%8s %16s %10.1f %10.1f %10.1f %12.1f" %
+                      (name, storage, best[0], best[1], best[2], mem))
+
+    # q_sort, q_reverseK and q_swap of random strings on the list of a compact
+    # queue against the ring index of a ringindex queue, in ns/element, best
+    # of three.
+    # The queue is sorted first so that its nodes are scattered in memory.
+    def ring(self):
+        n = self.size
+        ops = [("sort", ["sort"]), ("reverseK", ["sort", "time reverseK 3"]),
+               ("swap", ["sort", "time swap"])]
+        print("%10s %12s %12s %8s" % ("op", "list ns/elt", "ring ns/elt",
+                                      "speedup"))
+        for name, cmds in ops:
+            ns = []
+            for storage in ["compact", "ringindex"]:
+                fill = ["new %s" % storage, "ih RAND %d" % n]
+                if name == "sort":
+                    res = [self.runScript(fill + cmds)[-1][1]
+                           for _ in range(3)]
+                else:
+                    res = [self.runTimes(fill + cmds)[-1] * 1e9 / n
+                           for _ in range(3)]
+                ns.append(min(res))
+            print("%10s %12.1f %12.1f %7.2fx" % (name, ns[0], ns[1],
+                                                 ns[0] / ns[1]))
+
+    # list_sort with the comparison inlined against the generic list_sort
+    # calling it through a function pointer, for each 'option order'.  Each
+    # run is a fresh process and the best of three is kept.
+    def lsort(self):
+        print("%6s %22s %22s" % ("order", "generic cmps  ns/elt",
+                                 "inlined cmps  ns/elt"))
+        rand = random.Random(1)
+        for order in ["asc", "desc", "len", "int"]:
+            if order == "int":
+                fill = ["ih %d" % rand.randrange(-2**31, 2**31)
+                        for _ in range(self.size)]
+            else:
+                fill = ["ih RAND %d" % self.size]
+            line = "%6s" % order
+            for generic in [1, 0]:
+                cmds = ["option order %s" % order,
+                        "option lsort_generic %d" % generic, "new"]
+                cmds += fill + ["list_sort", "free"]
+                res = [self.runScript(cmds)[-1] for _ in range(3)]
+                line += " %12d %9.1f" % min(res, key=lambda r: r[1])
+            print(line)
+    # list_sort with and without galloping merges on inputs of growing
+    # disorder
+    def gallop(self):
+        inputs = [
+            ("sorted", ["sort"]),
+            ("reverse", ["sort", "reverse"]),
+            ("nearly", ["sort", "reverseK 8"]),
+            ("append", ["sort", "it RAND %d" % (self.size // 100)]),
+            ("random", []),
+        ]
+        print("%8s %22s %22s" % ("input", "linear cmps  ns/elt",
+                                 "gallop cmps  ns/elt"))
+        for name, prep in inputs:
+            line = "%8s" % name
+            for gallop in [0, 1]:
+                cmds = ["option gallop %d" % gallop, "new",
+                        "ih RAND %d" % self.size] + prep
+                cmds += ["list_sort", "free"]
+                line += " %12d %9.1f" % self.runScript(cmds)[-1]
+            print(line)
+
+    # Each q_sort engine on inputs from append logs to random keys, with
+    # 'auto' picking one of the others from a sample.  Best of three.
+    def engines(self):
+        n = self.size
+        rand = random.Random(1)
+        words = ["".join(rand.choice("abcdefghij") for _ in range(6))
+                 for _ in range(64)]
+        inputs = [
+            ("random", ["ih RAND %d" % n]),
+            ("sorted", ["ih RAND %d" % n, "sort"]),
+            ("append", ["ih RAND %d" % n, "sort", "it RAND %d" % (n // 100)]),
+            ("reverse", ["ih RAND %d" % n, "sort", "reverse"]),
+            ("dups", ["it %s" % rand.choice(words) for _ in range(n)]),
+            ("prefix", ["it https://example.com/item/%08d" %
+                        rand.randrange(10**8) for _ in range(n)]),
+            ("ints", ["it %d" % rand.randrange(10**9) for _ in range(n)]),
+        ]
+        algos = ["merge", "radix", "list", "auto"]
+        print("%8s" % "input" + "".join("%10s" % a for a in algos))
+        for name, fill in inputs:
+            line = "%8s" % name
+            for algo in algos:
+                cmds = ["option bench 0", "new"] + fill
+                cmds += ["option bench 1", "option sortalgo %s" % algo,
+                         "sort", "free"]
+                res = [self.runScript(cmds)[-1] for _ in range(3)]
+                line += " %9.1f" % min(r[1] for r in res)
+            print(line)
+
+    # q_sort of the program built with 'make KEYPACK=1' against a baseline
+    # with the plain key prefix: the share of comparisons the keys leave to
+    # strcmp() and ns/element, best of three.  The inputs are random strings,
+    # lowercase words sharing 8 to 10 letters and trace-14 style duplicates.
+    def keys(self):
+        n = self.size
+        rand = random.Random(1)
+        stems = ["".join(rand.choice("abcdefghijklmnopqrstuvwxyz")
+                         for _ in range(rand.randrange(8, 11)))
+                 for _ in range(16)]
+        inputs = [
+            ("random", ["ih RAND %d" % n]),
+            ("words", ["it %s%s" % (rand.choice(stems),
+                                    rand.choice("abcdefghijklmnopqrstuvwxyz"))
+                       for _ in range(n)]),
+            ("dups", ["ih dolphin %d" % (n // 2), "ih gerbil %d" % (n // 2),
+                      "reverseK 3"]),
+        ]
+        print("%8s %22s %22s %8s" % ("input", "base ties%   ns/elt",
+                                     "packed ties%   ns/elt", "speedup"))
+        for name, fill in inputs:
+            line = "%8s" % name
+            ns = []
+            for prog in [self.base, self.qtest]:
+                cmds = ["option bench 0", "new"] + fill
+                cmds += ["option bench 1", "sort", "free"]
+                best = None
+                for _ in range(3):
+                    out = self.runOutput(cmds, prog)
+                    t = float(re.findall(r"([0-9.]+) ns/element", out)[-1])
+                    ties = float(re.findall(r"\(([0-9.]+)% of comparisons",
+                                            out)[-1])
+                    best = min(best or (t, ties), (t, ties))
+                ns.append(best[0])
+                line += " %12.1f %9.1f" % (best[1], best[0])
+            print(line + " %7.2fx" % (ns[0] / ns[1]))
+
+    # List walks and merges of the program against a baseline built with
+    # 'make PREFETCH=0', in ns/element, best of three fresh processes.  The
+    # queue is sorted first so that its nodes are scattered in memory.  Meant
+    # for 1M elements and up; much past 1M, the sorts run into the time limit
+    # of qtest.
+    def prefetch(self):
+        n = self.size
+        fill = ["new", "ih RAND %d" % n]
+        halves = ["new", "ih RAND %d" % (n // 2), "sort",
+                  "new", "ih RAND %d" % (n - n // 2), "sort"]
+        ops = [
+            ("sort", "ns", fill + ["sort"]),
+            ("list_sort", "ns", fill + ["list_sort"]),
+            ("merge", "ns", halves + ["merge"]),
+            ("show", "time", fill + ["sort", "time show"]),
+            ("dedup", "time", fill + ["sort", "time dedup"]),
+            ("free", "time", fill + ["sort", "time free"]),
+        ]
+        print("%10s %12s %12s %8s" % ("op", "base ns/elt", "ns/elt",
+                                      "speedup"))
+        for name, kind, cmds in ops:
+            ns = []
+            for prog in [self.base, self.qtest]:
+                if kind == "ns":
+                    res = [self.runScript(cmds, prog)[-1][1]
+                           for _ in range(3)]
+                else:
+                    res = [self.runTimes(cmds, prog)[-1] * 1e9 / n
+                           for _ in range(3)]
+                ns.append(min(res))
+            print("%10s %12.1f %12.1f %7.2fx" % (name, ns[0], ns[1],
+                                                 ns[0] / ns[1]))
+
+
+benchDict = {
+    "engines": Bench.engines,
+    "gallop": Bench.gallop,
+    "insert": Bench.insert,
+    "intern": Bench.intern,
+    "keys": Bench.keys,
+    "lsort": Bench.lsort,
+    "merge": Bench.merge,
+    "prefetch": Bench.prefetch,
+    "ring": Bench.ring,
+    "storage": Bench.storage,
+    "threads": Bench.threads,
+    "topk": Bench.topk,
+}
+
+
+def usage(name):
+    print("Usage: %s [-h] [-p PROG] [-b BASE] [-n SIZE] [-j THREADS] BENCH"
+          % name)
+    print("  -h        Print this message")
+    print("  -p PROG   Program to benchmark")
+    print("  -b BASE   Program to compare against (prefetch, keys)")
+    print("  -n SIZE   Number of elements")
+    print("  -j THREADS Maximum number of sort threads")
+    print("  BENCH     One of: %s" % ", ".join(sorted(benchDict.keys())))
+    sys.exit(0)
+
+
+def run(name, args):
+    prog = ""
+    base = ""
+    size = 0
+    threads = 0
+
+    optlist, args = getopt.getopt(args, 'hp:b:n:j:')
+    for (opt, val) in optlist:
+        if opt == '-h':
+            usage(name)
+        elif opt == '-p':
+            prog = val
+        elif opt == '-b':
+            base = val
+        elif opt == '-n':
+            size = int(val)
+        elif opt == '-j':
+            threads = int(val)
+    if len(args) != 1 or args[0] not in benchDict:
+        usage(name)
+    benchDict[args[0]](Bench(qtest=prog, size=size, threads=threads,
+                                  base=base))
+
+
+if __name__ == "__main__":
+    run(sys.argv[0], sys.argv[1:])
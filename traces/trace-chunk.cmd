@@ -0,0 +1,80 @@
+# Test a queue stored in chunks of element pointers: head and tail operations
+# across chunk boundaries, reversed too, operations that link the list first,
+# inserts after them that read it back into chunks, a merge, chunks that
+# cannot be allocated, and constant-time insert and remove
+option fail 0
+option malloc 0
+new chunk
+it b 100
+ih a 100
+it c
+rh a
+rt c
+reverse
+ih z
+it y
+rh z
+rt y
+reverse
+size
+reverseK 3
+sort
+rh a
+swap
+reverse
+reverseK 4
+ih d
+it 0
+sort
+rh 0
+rt d
+dm
+ih z
+sort
+rt z
+free
+new chunk
+ih gerbil
+ih bear
+ih dolphin
+reverse
+it meerkat
+it bear
+sort
+dedup
+is lion
+it mole
+rh dolphin
+rh gerbil
+rh lion
+rh meerkat
+rh mole
+free
+new chunk
+ih RAND 300
+new chunk
+it RAND 300
+merge
+sort
+ih zzzzzzzzzzz
+descend
+rh zzzzzzzzzzz
+size
+free
+new chunk
+option fail 400
+option malloc 50
+ih dolphin 200
+it gerbil 200
+option malloc 0
+option fail 0
+rh dolphin
+rt gerbil
+free
+option pool chunk
+option simulation 1
+it
+ih
+rh
+rt
+option simulation 0
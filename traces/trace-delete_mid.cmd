@@ -0,0 +1,40 @@
+# Test of q_delete_mid on queues grown and shrunk at both ends and reversed,
+# and that it takes constant time
+option fail 0
+option malloc 0
+new
+it a
+it b
+it c
+it d
+dm
+rh a
+rh b
+rh d
+it a
+it b
+it c
+ih z
+reverse
+dm
+rh c
+rh b
+rh z
+it a
+it b
+it c
+it d
+it e
+it f
+sort
+reverse
+dm
+rt a
+rt b
+rh f
+rh e
+rh d
+free
+option simulation 1
+dm
+option simulation 0
@@ -0,0 +1,547 @@
+# Worst case 1 for dedup found by 'fuzz dedup 200 1000': 38.15 ns/element
+# 1000 strings of 1-1 letters a-v after a prefix of 24, 100.0% distinct, ascending runs of 52, 1% swapped, seed 0x380968d1463e27a4
+option fail 0
+option malloc 0
+new
+it dadscrdhsrsabeflrntuelqda 3
+it dadscrdhsrsabeflrntuelqdb
+it dadscrdhsrsabeflrntuelqdc 6
+it dadscrdhsrsabeflrntuelqdd 3
+it dadscrdhsrsabeflrntuelqde
+it dadscrdhsrsabeflrntuelqdf 3
+it dadscrdhsrsabeflrntuelqdh
+it dadscrdhsrsabeflrntuelqdi
+it dadscrdhsrsabeflrntuelqdj 2
+it dadscrdhsrsabeflrntuelqdl 3
+it dadscrdhsrsabeflrntuelqdm 3
+it dadscrdhsrsabeflrntuelqdn 4
+it dadscrdhsrsabeflrntuelqdo 4
+it dadscrdhsrsabeflrntuelqdp 4
+it dadscrdhsrsabeflrntuelqdq 3
+it dadscrdhsrsabeflrntuelqdr 3
+it dadscrdhsrsabeflrntuelqdt 3
+it dadscrdhsrsabeflrntuelqdu
+it dadscrdhsrsabeflrntuelqdv
+it dadscrdhsrsabeflrntuelqdm
+it dadscrdhsrsabeflrntuelqdv
+it dadscrdhsrsabeflrntuelqda
+it dadscrdhsrsabeflrntuelqdb 4
+it dadscrdhsrsabeflrntuelqdc 3
+it dadscrdhsrsabeflrntuelqde
+it dadscrdhsrsabeflrntuelqdf 4
+it dadscrdhsrsabeflrntuelqde
+it dadscrdhsrsabeflrntuelqdg 5
+it dadscrdhsrsabeflrntuelqdh 2
+it dadscrdhsrsabeflrntuelqdi 2
+it dadscrdhsrsabeflrntuelqdj 4
+it dadscrdhsrsabeflrntuelqdk
+it dadscrdhsrsabeflrntuelqdm 3
+it dadscrdhsrsabeflrntuelqdn
+it dadscrdhsrsabeflrntuelqdo
+it dadscrdhsrsabeflrntuelqdp 3
+it dadscrdhsrsabeflrntuelqdq 3
+it dadscrdhsrsabeflrntuelqdr 3
+it dadscrdhsrsabeflrntuelqds 5
+it dadscrdhsrsabeflrntuelqdt 2
+it dadscrdhsrsabeflrntuelqdu 3
+it dadscrdhsrsabeflrntuelqda 2
+it dadscrdhsrsabeflrntuelqdb 4
+it dadscrdhsrsabeflrntuelqdc
+it dadscrdhsrsabeflrntuelqdd 2
+it dadscrdhsrsabeflrntuelqde
+it dadscrdhsrsabeflrntuelqdf
+it dadscrdhsrsabeflrntuelqdv
+it dadscrdhsrsabeflrntuelqdf 2
+it dadscrdhsrsabeflrntuelqdh 5
+it dadscrdhsrsabeflrntuelqdi
+it dadscrdhsrsabeflrntuelqdj 2
+it dadscrdhsrsabeflrntuelqdk 3
+it dadscrdhsrsabeflrntuelqdl 4
+it dadscrdhsrsabeflrntuelqdm 2
+it dadscrdhsrsabeflrntuelqdo
+it dadscrdhsrsabeflrntuelqdp 4
+it dadscrdhsrsabeflrntuelqdq 4
+it dadscrdhsrsabeflrntuelqdr
+it dadscrdhsrsabeflrntuelqdg
+it dadscrdhsrsabeflrntuelqdr
+it dadscrdhsrsabeflrntuelqds
+it dadscrdhsrsabeflrntuelqdt 5
+it dadscrdhsrsabeflrntuelqdu
+it dadscrdhsrsabeflrntuelqdv 2
+it dadscrdhsrsabeflrntuelqdc 2
+it dadscrdhsrsabeflrntuelqdd 4
+it dadscrdhsrsabeflrntuelqde
+it dadscrdhsrsabeflrntuelqdf 4
+it dadscrdhsrsabeflrntuelqdg
+it dadscrdhsrsabeflrntuelqdh 4
+it dadscrdhsrsabeflrntuelqdv
+it dadscrdhsrsabeflrntuelqdi 3
+it dadscrdhsrsabeflrntuelqdj
+it dadscrdhsrsabeflrntuelqdk 3
+it dadscrdhsrsabeflrntuelqdl
+it dadscrdhsrsabeflrntuelqdm 2
+it dadscrdhsrsabeflrntuelqdn 4
+it dadscrdhsrsabeflrntuelqdp 2
+it dadscrdhsrsabeflrntuelqdq 4
+it dadscrdhsrsabeflrntuelqdr 3
+it dadscrdhsrsabeflrntuelqds 2
+it dadscrdhsrsabeflrntuelqdt 5
+it dadscrdhsrsabeflrntuelqdu
+it dadscrdhsrsabeflrntuelqdv 4
+it dadscrdhsrsabeflrntuelqda 2
+it dadscrdhsrsabeflrntuelqdb
+it dadscrdhsrsabeflrntuelqdc 3
+it dadscrdhsrsabeflrntuelqdd 3
+it dadscrdhsrsabeflrntuelqde 2
+it dadscrdhsrsabeflrntuelqdf 3
+it dadscrdhsrsabeflrntuelqdg 2
+it dadscrdhsrsabeflrntuelqdh
+it dadscrdhsrsabeflrntuelqdi
+it dadscrdhsrsabeflrntuelqdj 4
+it dadscrdhsrsabeflrntuelqdl 3
+it dadscrdhsrsabeflrntuelqdm 3
+it dadscrdhsrsabeflrntuelqdn
+it dadscrdhsrsabeflrntuelqdo 3
+it dadscrdhsrsabeflrntuelqdp 2
+it dadscrdhsrsabeflrntuelqdq
+it dadscrdhsrsabeflrntuelqdr 2
+it dadscrdhsrsabeflrntuelqds 3
+it dadscrdhsrsabeflrntuelqdt 5
+it dadscrdhsrsabeflrntuelqdu
+it dadscrdhsrsabeflrntuelqdv 6
+it dadscrdhsrsabeflrntuelqda 5
+it dadscrdhsrsabeflrntuelqdc 3
+it dadscrdhsrsabeflrntuelqdd 2
+it dadscrdhsrsabeflrntuelqde 3
+it dadscrdhsrsabeflrntuelqdf
+it dadscrdhsrsabeflrntuelqdg 4
+it dadscrdhsrsabeflrntuelqdh 2
+it dadscrdhsrsabeflrntuelqdi
+it dadscrdhsrsabeflrntuelqdj 2
+it dadscrdhsrsabeflrntuelqdk
+it dadscrdhsrsabeflrntuelqdl 4
+it dadscrdhsrsabeflrntuelqdm 3
+it dadscrdhsrsabeflrntuelqdn 2
+it dadscrdhsrsabeflrntuelqdo 2
+it dadscrdhsrsabeflrntuelqdp
+it dadscrdhsrsabeflrntuelqdq 3
+it dadscrdhsrsabeflrntuelqdr 4
+it dadscrdhsrsabeflrntuelqds 3
+it dadscrdhsrsabeflrntuelqdt
+it dadscrdhsrsabeflrntuelqdu 4
+it dadscrdhsrsabeflrntuelqdv
+it dadscrdhsrsabeflrntuelqda
+it dadscrdhsrsabeflrntuelqdb 2
+it dadscrdhsrsabeflrntuelqdc
+it dadscrdhsrsabeflrntuelqdd 2
+it dadscrdhsrsabeflrntuelqde 4
+it dadscrdhsrsabeflrntuelqdf 4
+it dadscrdhsrsabeflrntuelqdr
+it dadscrdhsrsabeflrntuelqdg 4
+it dadscrdhsrsabeflrntuelqdh 3
+it dadscrdhsrsabeflrntuelqdi 3
+it dadscrdhsrsabeflrntuelqdj
+it dadscrdhsrsabeflrntuelqdk 5
+it dadscrdhsrsabeflrntuelqdl
+it dadscrdhsrsabeflrntuelqdm 2
+it dadscrdhsrsabeflrntuelqdn 2
+it dadscrdhsrsabeflrntuelqdo 2
+it dadscrdhsrsabeflrntuelqdq 2
+it dadscrdhsrsabeflrntuelqdr 2
+it dadscrdhsrsabeflrntuelqds 3
+it dadscrdhsrsabeflrntuelqdt
+it dadscrdhsrsabeflrntuelqdu 4
+it dadscrdhsrsabeflrntuelqdv 2
+it dadscrdhsrsabeflrntuelqda
+it dadscrdhsrsabeflrntuelqdb
+it dadscrdhsrsabeflrntuelqdc 3
+it dadscrdhsrsabeflrntuelqdd 2
+it dadscrdhsrsabeflrntuelqde
+it dadscrdhsrsabeflrntuelqdg
+it dadscrdhsrsabeflrntuelqdh 2
+it dadscrdhsrsabeflrntuelqdi 3
+it dadscrdhsrsabeflrntuelqdj 2
+it dadscrdhsrsabeflrntuelqdk 3
+it dadscrdhsrsabeflrntuelqdl 4
+it dadscrdhsrsabeflrntuelqdm 4
+it dadscrdhsrsabeflrntuelqdn 3
+it dadscrdhsrsabeflrntuelqdo 5
+it dadscrdhsrsabeflrntuelqdp 4
+it dadscrdhsrsabeflrntuelqdq
+it dadscrdhsrsabeflrntuelqdr 5
+it dadscrdhsrsabeflrntuelqds
+it dadscrdhsrsabeflrntuelqdt
+it dadscrdhsrsabeflrntuelqdu 3
+it dadscrdhsrsabeflrntuelqdv 2
+it dadscrdhsrsabeflrntuelqda 3
+it dadscrdhsrsabeflrntuelqdp
+it dadscrdhsrsabeflrntuelqdc
+it dadscrdhsrsabeflrntuelqdd
+it dadscrdhsrsabeflrntuelqde 2
+it dadscrdhsrsabeflrntuelqdf
+it dadscrdhsrsabeflrntuelqdg 3
+it dadscrdhsrsabeflrntuelqdi 6
+it dadscrdhsrsabeflrntuelqdj 2
+it dadscrdhsrsabeflrntuelqdk 2
+it dadscrdhsrsabeflrntuelqdl 7
+it dadscrdhsrsabeflrntuelqdm 3
+it dadscrdhsrsabeflrntuelqdn
+it dadscrdhsrsabeflrntuelqdo 3
+it dadscrdhsrsabeflrntuelqdp
+it dadscrdhsrsabeflrntuelqdc
+it dadscrdhsrsabeflrntuelqdq 3
+it dadscrdhsrsabeflrntuelqdr
+it dadscrdhsrsabeflrntuelqds 4
+it dadscrdhsrsabeflrntuelqdt 5
+it dadscrdhsrsabeflrntuelqdu
+it dadscrdhsrsabeflrntuelqda
+it dadscrdhsrsabeflrntuelqdb 4
+it dadscrdhsrsabeflrntuelqdc 3
+it dadscrdhsrsabeflrntuelqdd 2
+it dadscrdhsrsabeflrntuelqdf 2
+it dadscrdhsrsabeflrntuelqdg 4
+it dadscrdhsrsabeflrntuelqdh 4
+it dadscrdhsrsabeflrntuelqdi 4
+it dadscrdhsrsabeflrntuelqdj 3
+it dadscrdhsrsabeflrntuelqdk 2
+it dadscrdhsrsabeflrntuelqdl
+it dadscrdhsrsabeflrntuelqdm 3
+it dadscrdhsrsabeflrntuelqdn
+it dadscrdhsrsabeflrntuelqdo
+it dadscrdhsrsabeflrntuelqdp 2
+it dadscrdhsrsabeflrntuelqdq 5
+it dadscrdhsrsabeflrntuelqdr 3
+it dadscrdhsrsabeflrntuelqds 3
+it dadscrdhsrsabeflrntuelqdu 3
+it dadscrdhsrsabeflrntuelqdv
+it dadscrdhsrsabeflrntuelqds
+it dadscrdhsrsabeflrntuelqda
+it dadscrdhsrsabeflrntuelqdb 3
+it dadscrdhsrsabeflrntuelqdc 2
+it dadscrdhsrsabeflrntuelqdd 2
+it dadscrdhsrsabeflrntuelqde
+it dadscrdhsrsabeflrntuelqdf 5
+it dadscrdhsrsabeflrntuelqdg
+it dadscrdhsrsabeflrntuelqdh 4
+it dadscrdhsrsabeflrntuelqdi 3
+it dadscrdhsrsabeflrntuelqdj 2
+it dadscrdhsrsabeflrntuelqdk 2
+it dadscrdhsrsabeflrntuelqdl 3
+it dadscrdhsrsabeflrntuelqdm 2
+it dadscrdhsrsabeflrntuelqdn
+it dadscrdhsrsabeflrntuelqdo
+it dadscrdhsrsabeflrntuelqdp 2
+it dadscrdhsrsabeflrntuelqdq 2
+it dadscrdhsrsabeflrntuelqdr 5
+it dadscrdhsrsabeflrntuelqds
+it dadscrdhsrsabeflrntuelqdt 4
+it dadscrdhsrsabeflrntuelqdu
+it dadscrdhsrsabeflrntuelqdv 3
+it dadscrdhsrsabeflrntuelqda 2
+it dadscrdhsrsabeflrntuelqdb 4
+it dadscrdhsrsabeflrntuelqdc 3
+it dadscrdhsrsabeflrntuelqdd 2
+it dadscrdhsrsabeflrntuelqde
+it dadscrdhsrsabeflrntuelqdf
+it dadscrdhsrsabeflrntuelqdg
+it dadscrdhsrsabeflrntuelqdh 2
+it dadscrdhsrsabeflrntuelqdi 2
+it dadscrdhsrsabeflrntuelqdk 5
+it dadscrdhsrsabeflrntuelqdl 3
+it dadscrdhsrsabeflrntuelqdm 2
+it dadscrdhsrsabeflrntuelqdn 2
+it dadscrdhsrsabeflrntuelqdo
+it dadscrdhsrsabeflrntuelqdp 6
+it dadscrdhsrsabeflrntuelqdq 3
+it dadscrdhsrsabeflrntuelqdr 4
+it dadscrdhsrsabeflrntuelqdt
+it dadscrdhsrsabeflrntuelqdu 2
+it dadscrdhsrsabeflrntuelqdv 5
+it dadscrdhsrsabeflrntuelqda 2
+it dadscrdhsrsabeflrntuelqdb 3
+it dadscrdhsrsabeflrntuelqdc 4
+it dadscrdhsrsabeflrntuelqdf 2
+it dadscrdhsrsabeflrntuelqdg 2
+it dadscrdhsrsabeflrntuelqdi 4
+it dadscrdhsrsabeflrntuelqdj 3
+it dadscrdhsrsabeflrntuelqdl 4
+it dadscrdhsrsabeflrntuelqdm 2
+it dadscrdhsrsabeflrntuelqdn 3
+it dadscrdhsrsabeflrntuelqdo 2
+it dadscrdhsrsabeflrntuelqdp 3
+it dadscrdhsrsabeflrntuelqdq
+it dadscrdhsrsabeflrntuelqdr 7
+it dadscrdhsrsabeflrntuelqds 2
+it dadscrdhsrsabeflrntuelqdt 4
+it dadscrdhsrsabeflrntuelqdv 4
+it dadscrdhsrsabeflrntuelqda 2
+it dadscrdhsrsabeflrntuelqdb 3
+it dadscrdhsrsabeflrntuelqdc 2
+it dadscrdhsrsabeflrntuelqdd 4
+it dadscrdhsrsabeflrntuelqde 5
+it dadscrdhsrsabeflrntuelqdf 2
+it dadscrdhsrsabeflrntuelqdg 3
+it dadscrdhsrsabeflrntuelqdh 2
+it dadscrdhsrsabeflrntuelqdi
+it dadscrdhsrsabeflrntuelqdl 4
+it dadscrdhsrsabeflrntuelqdm 3
+it dadscrdhsrsabeflrntuelqdn 2
+it dadscrdhsrsabeflrntuelqdo
+it dadscrdhsrsabeflrntuelqdp 4
+it dadscrdhsrsabeflrntuelqdq 4
+it dadscrdhsrsabeflrntuelqdr 3
+it dadscrdhsrsabeflrntuelqds 2
+it dadscrdhsrsabeflrntuelqdt
+it dadscrdhsrsabeflrntuelqdu 2
+it dadscrdhsrsabeflrntuelqdv 2
+it dadscrdhsrsabeflrntuelqda 3
+it dadscrdhsrsabeflrntuelqdb 2
+it dadscrdhsrsabeflrntuelqdd 3
+it dadscrdhsrsabeflrntuelqde 3
+it dadscrdhsrsabeflrntuelqdf 2
+it dadscrdhsrsabeflrntuelqdg 4
+it dadscrdhsrsabeflrntuelqdh 2
+it dadscrdhsrsabeflrntuelqdi 2
+it dadscrdhsrsabeflrntuelqdj
+it dadscrdhsrsabeflrntuelqdk 2
+it dadscrdhsrsabeflrntuelqdl
+it dadscrdhsrsabeflrntuelqdm
+it dadscrdhsrsabeflrntuelqdo 3
+it dadscrdhsrsabeflrntuelqdp 2
+it dadscrdhsrsabeflrntuelqdd
+it dadscrdhsrsabeflrntuelqdp 2
+it dadscrdhsrsabeflrntuelqdq 5
+it dadscrdhsrsabeflrntuelqdr 3
+it dadscrdhsrsabeflrntuelqds 2
+it dadscrdhsrsabeflrntuelqdt
+it dadscrdhsrsabeflrntuelqdu 3
+it dadscrdhsrsabeflrntuelqdf
+it dadscrdhsrsabeflrntuelqdv 3
+it dadscrdhsrsabeflrntuelqda
+it dadscrdhsrsabeflrntuelqdb 2
+it dadscrdhsrsabeflrntuelqdd
+it dadscrdhsrsabeflrntuelqde 2
+it dadscrdhsrsabeflrntuelqdf 4
+it dadscrdhsrsabeflrntuelqdg
+it dadscrdhsrsabeflrntuelqdh 5
+it dadscrdhsrsabeflrntuelqdi 3
+it dadscrdhsrsabeflrntuelqdj 4
+it dadscrdhsrsabeflrntuelqdk 2
+it dadscrdhsrsabeflrntuelqdm 2
+it dadscrdhsrsabeflrntuelqdo
+it dadscrdhsrsabeflrntuelqdi
+it dadscrdhsrsabeflrntuelqdm 2
+it dadscrdhsrsabeflrntuelqdn 2
+it dadscrdhsrsabeflrntuelqdo
+it dadscrdhsrsabeflrntuelqdp 2
+it dadscrdhsrsabeflrntuelqdq 3
+it dadscrdhsrsabeflrntuelqdr 3
+it dadscrdhsrsabeflrntuelqds
+it dadscrdhsrsabeflrntuelqdt 2
+it dadscrdhsrsabeflrntuelqdu 4
+it dadscrdhsrsabeflrntuelqdv 3
+it dadscrdhsrsabeflrntuelqda 4
+it dadscrdhsrsabeflrntuelqdc
+it dadscrdhsrsabeflrntuelqdp
+it dadscrdhsrsabeflrntuelqdd
+it dadscrdhsrsabeflrntuelqde 2
+it dadscrdhsrsabeflrntuelqdf 2
+it dadscrdhsrsabeflrntuelqdg 3
+it dadscrdhsrsabeflrntuelqdh 4
+it dadscrdhsrsabeflrntuelqdi 2
+it dadscrdhsrsabeflrntuelqdj 4
+it dadscrdhsrsabeflrntuelqdk
+it dadscrdhsrsabeflrntuelqdl 2
+it dadscrdhsrsabeflrntuelqdm 4
+it dadscrdhsrsabeflrntuelqdn 2
+it dadscrdhsrsabeflrntuelqdo 3
+it dadscrdhsrsabeflrntuelqdp
+it dadscrdhsrsabeflrntuelqdq
+it dadscrdhsrsabeflrntuelqdr 4
+it dadscrdhsrsabeflrntuelqds
+it dadscrdhsrsabeflrntuelqdt 3
+it dadscrdhsrsabeflrntuelqdu 2
+it dadscrdhsrsabeflrntuelqdv 4
+it dadscrdhsrsabeflrntuelqda 2
+it dadscrdhsrsabeflrntuelqdc 5
+it dadscrdhsrsabeflrntuelqdd 2
+it dadscrdhsrsabeflrntuelqde 3
+it dadscrdhsrsabeflrntuelqdf
+it dadscrdhsrsabeflrntuelqde 2
+it dadscrdhsrsabeflrntuelqdf 4
+it dadscrdhsrsabeflrntuelqdg 4
+it dadscrdhsrsabeflrntuelqdh
+it dadscrdhsrsabeflrntuelqdi 2
+it dadscrdhsrsabeflrntuelqdj 3
+it dadscrdhsrsabeflrntuelqdk 2
+it dadscrdhsrsabeflrntuelqdl 3
+it dadscrdhsrsabeflrntuelqdm
+it dadscrdhsrsabeflrntuelqdn 2
+it dadscrdhsrsabeflrntuelqdo
+it dadscrdhsrsabeflrntuelqdp 2
+it dadscrdhsrsabeflrntuelqdq 2
+it dadscrdhsrsabeflrntuelqdr 2
+it dadscrdhsrsabeflrntuelqds 2
+it dadscrdhsrsabeflrntuelqdt 2
+it dadscrdhsrsabeflrntuelqdu 2
+it dadscrdhsrsabeflrntuelqdv 2
+it dadscrdhsrsabeflrntuelqda 2
+it dadscrdhsrsabeflrntuelqdb 2
+it dadscrdhsrsabeflrntuelqdc 5
+it dadscrdhsrsabeflrntuelqdd 2
+it dadscrdhsrsabeflrntuelqde 2
+it dadscrdhsrsabeflrntuelqdf 6
+it dadscrdhsrsabeflrntuelqdg
+it dadscrdhsrsabeflrntuelqdh 4
+it dadscrdhsrsabeflrntuelqdi 4
+it dadscrdhsrsabeflrntuelqdk 3
+it dadscrdhsrsabeflrntuelqdl
+it dadscrdhsrsabeflrntuelqdm 4
+it dadscrdhsrsabeflrntuelqdn 3
+it dadscrdhsrsabeflrntuelqdm
+it dadscrdhsrsabeflrntuelqdp 3
+it dadscrdhsrsabeflrntuelqdq
+it dadscrdhsrsabeflrntuelqdr
+it dadscrdhsrsabeflrntuelqda
+it dadscrdhsrsabeflrntuelqds
+it dadscrdhsrsabeflrntuelqdt
+it dadscrdhsrsabeflrntuelqdu 2
+it dadscrdhsrsabeflrntuelqdv 2
+it dadscrdhsrsabeflrntuelqda
+it dadscrdhsrsabeflrntuelqdc 3
+it dadscrdhsrsabeflrntuelqdg
+it dadscrdhsrsabeflrntuelqdj
+it dadscrdhsrsabeflrntuelqdk
+it dadscrdhsrsabeflrntuelqdp 2
+it dadscrdhsrsabeflrntuelqdq
+it dadscrdhsrsabeflrntuelqdr
+it dadscrdhsrsabeflrntuelqdv
+time dedup
+rh dadscrdhsrsabeflrntuelqdb
+rh dadscrdhsrsabeflrntuelqde
+rh dadscrdhsrsabeflrntuelqdh
+rh dadscrdhsrsabeflrntuelqdi
+rh dadscrdhsrsabeflrntuelqdu
+rh dadscrdhsrsabeflrntuelqdv
+rh dadscrdhsrsabeflrntuelqdm
+rh dadscrdhsrsabeflrntuelqdv
+rh dadscrdhsrsabeflrntuelqda
+rh dadscrdhsrsabeflrntuelqde
+rh dadscrdhsrsabeflrntuelqde
+rh dadscrdhsrsabeflrntuelqdk
+rh dadscrdhsrsabeflrntuelqdn
+rh dadscrdhsrsabeflrntuelqdo
+rh dadscrdhsrsabeflrntuelqdc
+rh dadscrdhsrsabeflrntuelqde
+rh dadscrdhsrsabeflrntuelqdf
+rh dadscrdhsrsabeflrntuelqdv
+rh dadscrdhsrsabeflrntuelqdi
+rh dadscrdhsrsabeflrntuelqdo
+rh dadscrdhsrsabeflrntuelqdr
+rh dadscrdhsrsabeflrntuelqdg
+rh dadscrdhsrsabeflrntuelqdr
+rh dadscrdhsrsabeflrntuelqds
+rh dadscrdhsrsabeflrntuelqdu
+rh dadscrdhsrsabeflrntuelqde
+rh dadscrdhsrsabeflrntuelqdg
+rh dadscrdhsrsabeflrntuelqdv
+rh dadscrdhsrsabeflrntuelqdj
+rh dadscrdhsrsabeflrntuelqdl
+rh dadscrdhsrsabeflrntuelqdu
+rh dadscrdhsrsabeflrntuelqdb
+rh dadscrdhsrsabeflrntuelqdh
+rh dadscrdhsrsabeflrntuelqdi
+rh dadscrdhsrsabeflrntuelqdn
+rh dadscrdhsrsabeflrntuelqdq
+rh dadscrdhsrsabeflrntuelqdu
+rh dadscrdhsrsabeflrntuelqdf
+rh dadscrdhsrsabeflrntuelqdi
+rh dadscrdhsrsabeflrntuelqdk
+rh dadscrdhsrsabeflrntuelqdp
+rh dadscrdhsrsabeflrntuelqdt
+rh dadscrdhsrsabeflrntuelqdv
+rh dadscrdhsrsabeflrntuelqda
+rh dadscrdhsrsabeflrntuelqdc
+rh dadscrdhsrsabeflrntuelqdr
+rh dadscrdhsrsabeflrntuelqdj
+rh dadscrdhsrsabeflrntuelqdl
+rh dadscrdhsrsabeflrntuelqdt
+rh dadscrdhsrsabeflrntuelqda
+rh dadscrdhsrsabeflrntuelqdb
+rh dadscrdhsrsabeflrntuelqde
+rh dadscrdhsrsabeflrntuelqdg
+rh dadscrdhsrsabeflrntuelqdq
+rh dadscrdhsrsabeflrntuelqds
+rh dadscrdhsrsabeflrntuelqdt
+rh dadscrdhsrsabeflrntuelqdp
+rh dadscrdhsrsabeflrntuelqdc
+rh dadscrdhsrsabeflrntuelqdd
+rh dadscrdhsrsabeflrntuelqdf
+rh dadscrdhsrsabeflrntuelqdn
+rh dadscrdhsrsabeflrntuelqdp
+rh dadscrdhsrsabeflrntuelqdc
+rh dadscrdhsrsabeflrntuelqdr
+rh dadscrdhsrsabeflrntuelqdu
+rh dadscrdhsrsabeflrntuelqda
+rh dadscrdhsrsabeflrntuelqdl
+rh dadscrdhsrsabeflrntuelqdn
+rh dadscrdhsrsabeflrntuelqdo
+rh dadscrdhsrsabeflrntuelqdv
+rh dadscrdhsrsabeflrntuelqds
+rh dadscrdhsrsabeflrntuelqda
+rh dadscrdhsrsabeflrntuelqde
+rh dadscrdhsrsabeflrntuelqdg
+rh dadscrdhsrsabeflrntuelqdn
+rh dadscrdhsrsabeflrntuelqdo
+rh dadscrdhsrsabeflrntuelqds
+rh dadscrdhsrsabeflrntuelqdu
+rh dadscrdhsrsabeflrntuelqde
+rh dadscrdhsrsabeflrntuelqdf
+rh dadscrdhsrsabeflrntuelqdg
+rh dadscrdhsrsabeflrntuelqdo
+rh dadscrdhsrsabeflrntuelqdt
+rh dadscrdhsrsabeflrntuelqdq
+rh dadscrdhsrsabeflrntuelqdi
+rh dadscrdhsrsabeflrntuelqdo
+rh dadscrdhsrsabeflrntuelqdt
+rh dadscrdhsrsabeflrntuelqdj
+rh dadscrdhsrsabeflrntuelqdl
+rh dadscrdhsrsabeflrntuelqdm
+rh dadscrdhsrsabeflrntuelqdd
+rh dadscrdhsrsabeflrntuelqdt
+rh dadscrdhsrsabeflrntuelqdf
+rh dadscrdhsrsabeflrntuelqda
+rh dadscrdhsrsabeflrntuelqdd
+rh dadscrdhsrsabeflrntuelqdg
+rh dadscrdhsrsabeflrntuelqdo
+rh dadscrdhsrsabeflrntuelqdi
+rh dadscrdhsrsabeflrntuelqdo
+rh dadscrdhsrsabeflrntuelqds
+rh dadscrdhsrsabeflrntuelqdc
+rh dadscrdhsrsabeflrntuelqdp
+rh dadscrdhsrsabeflrntuelqdd
+rh dadscrdhsrsabeflrntuelqdk
+rh dadscrdhsrsabeflrntuelqdp
+rh dadscrdhsrsabeflrntuelqdq
+rh dadscrdhsrsabeflrntuelqds
+rh dadscrdhsrsabeflrntuelqdf
+rh dadscrdhsrsabeflrntuelqdh
+rh dadscrdhsrsabeflrntuelqdm
+rh dadscrdhsrsabeflrntuelqdo
+rh dadscrdhsrsabeflrntuelqdg
+rh dadscrdhsrsabeflrntuelqdl
+rh dadscrdhsrsabeflrntuelqdm
+rh dadscrdhsrsabeflrntuelqdq
+rh dadscrdhsrsabeflrntuelqdr
+rh dadscrdhsrsabeflrntuelqda
+rh dadscrdhsrsabeflrntuelqds
+rh dadscrdhsrsabeflrntuelqdt
+rh dadscrdhsrsabeflrntuelqda
+rh dadscrdhsrsabeflrntuelqdg
+rh dadscrdhsrsabeflrntuelqdj
+rh dadscrdhsrsabeflrntuelqdk
+rh dadscrdhsrsabeflrntuelqdq
+rh dadscrdhsrsabeflrntuelqdr
+rh dadscrdhsrsabeflrntuelqdv
+size
+free
@@ -0,0 +1,550 @@
+# Worst case 1 for descend found by 'fuzz descend 200 1000': 31.23 ns/element
+# 1000 strings of 9-9 letters a-n after a prefix of 10, 48.3% distinct, descending runs of 989, 4% swapped, seed 0x2ee96742fc0e714b
+option fail 0
+option malloc 0
+new
+it lbkgmmklfdnnjicfnjn 4
+it lbkgmmklfdnnelljcif
+it lbkgmmklfdnnbebigji
+it lbkgmmklfdhfaihfadl
+it lbkgmmklfdnlnhmakaa 4
+it lbkgmmklfdnljdbbnng 2
+it lbkgmmklfdnlekngjcd 4
+it lbkgmmklfdnlbcgadml 2
+it lbkgmmklfdnkfemfjeg 2
+it lbkgmmklfdnijkkkmlh 5
+it lbkgmmklfdnidjifhfc 3
+it lbkgmmklfdcindddfcd
+it lbkgmmklfdnidjifhfc
+it lbkgmmklfdnhigkleec
+it lbkgmmklfdngecaglcb 4
+it lbkgmmklfdnfabkbkma 3
+it lbkgmmklfdnelealfdi
+it lbkgmmklfdnefhhdbhc 2
+it lbkgmmklfdgnahgnidh
+it lbkgmmklfdnebjminjc 3
+it lbkgmmklfdnebddlnaa 3
+it lbkgmmklfdndnmijkli
+it lbkgmmklfdndiijlgim
+it lbkgmmklfdnbnnalmbd
+it lbkgmmklfdnbfhaafne
+it lbkgmmklfdnamdfblli
+it lbkgmmklfdnahickffn
+it lbkgmmklfdnacbeaekd 4
+it lbkgmmklfdnabglhhcm
+it lbkgmmklfdnaajnjmmm 4
+it lbkgmmklfdmnlndcbmf 3
+it lbkgmmklfdmnkmjgnae 2
+it lbkgmmklfdlgmmgnlbe
+it lbkgmmklfdmmneadcch 3
+it lbkgmmklfdmmfjflajd 3
+it lbkgmmklfdmmakkggkb
+it lbkgmmklfdgghnknlfd
+it lbkgmmklfdmmakkggkb 2
+it lbkgmmklfdmlhmdinnn 2
+it lbkgmmklfdmlefgbnlm
+it lbkgmmklfdmldcmajkj
+it lbkgmmklfdmlafeeiba 2
+it lbkgmmklfdmkmkbfhhh
+it lbkgmmklfdbljlchlii
+it lbkgmmklfdmkmkbfhhh
+it lbkgmmklfdmjlkljnlb 2
+it lbkgmmklfdmjjjflijm
+it lbkgmmklfdmjjcliidc 2
+it lbkgmmklfdmjecekfhc 2
+it lbkgmmklfdmibalagnj 4
+it lbkgmmklfdmiajmicdf 2
+it lbkgmmklfdmhnmngcnn 2
+it lbkgmmklfdmhmcnlgal 2
+it lbkgmmklfdmheahmilb 2
+it lbkgmmklfdmhcieiakk 4
+it lbkgmmklfdmgbnhjgfm 2
+it lbkgmmklfdcjggnenhn
+it lbkgmmklfdmfgakajkj 3
+it lbkgmmklfdmejljhbld
+it lbkgmmklfdmehifalnc 2
+it lbkgmmklfdmefblehif 2
+it lbkgmmklfdmcgjljlba 2
+it lbkgmmklfdmccibcefm 2
+it lbkgmmklfdmbnchicfn 3
+it lbkgmmklfdmaljeabkb
+it lbkgmmklfdmaklkdmah 4
+it lbkgmmklfdmaimmgjdj 3
+it lbkgmmklfdmaijeanfc
+it lbkgmmklfdmabafdafg 3
+it lbkgmmklfdmaafdngfl 3
+it lbkgmmklfdlnmbfihmn
+it lbkgmmklfdlnijjkbcf
+it lbkgmmklfdlmndkhham 2
+it lbkgmmklfdlmfgjjmcj
+it lbkgmmklfdllbbncgki
+it lbkgmmklfdlkmhakkek 3
+it lbkgmmklfdlkhclagnc
+it lbkgmmklfdljiakcjgk 3
+it lbkgmmklfdljhknfglf 2
+it lbkgmmklfdljgjedinh
+it lbkgmmklfdljaniicbk 3
+it lbkgmmklfdliigignng 2
+it lbkgmmklfdlighmgikd 2
+it lbkgmmklfdlifnekddm 2
+it lbkgmmklfdlhjieigei 3
+it lbkgmmklfdlhedlcimj 4
+it lbkgmmklfdlhckbhkme 2
+it lbkgmmklfdlhcgneamd
+it lbkgmmklfdlhbicglki
+it lbkgmmklfdlgmmgnlbe
+it lbkgmmklfdmmneadcch
+it lbkgmmklfdgfdlgafni
+it lbkgmmklfdlgdnmaffd
+it lbkgmmklfdlgbljiila
+it lbkgmmklfdlflbnmamd
+it lbkgmmklfdlfgeaeahd
+it lbkgmmklfdfaaihjhlf
+it lbkgmmklfdlfbhhnifl
+it lbkgmmklfdlfbbfcfeh 2
+it lbkgmmklfdleccnhgll
+it lbkgmmklfdlebckaccn 2
+it lbkgmmklfdfechimljc
+it lbkgmmklfdlcbbafhfd
+it lbkgmmklfdkickgagnj
+it lbkgmmklfdlbllehlej
+it lbkgmmklfdlbjmaekab
+it lbkgmmklfdjjnlfnlaa
+it lbkgmmklfdlanbngldj 2
+it lbkgmmklfdknjafhahl
+it lbkgmmklfdkmldjfann 3
+it lbkgmmklfdkmccabngj 3
+it lbkgmmklfdcefmnfikc
+it lbkgmmklfdkmbkljfhn
+it lbkgmmklfdklljihcmh
+it lbkgmmklfdklhckffnh 2
+it lbkgmmklfdkldkchajl 3
+it lbkgmmklfdkkjheicgm 2
+it lbkgmmklfdbbccadbdh
+it lbkgmmklfdkkhgflnkl 2
+it lbkgmmklfdkjiikmcia
+it lbkgmmklfdkjfihdeej 2
+it lbkgmmklfdkikdkenbl 3
+it lbkgmmklfdkiibcjgal 3
+it lbkgmmklfdccbncfhcj
+it lbkgmmklfdkiekgacnn 2
+it lbkgmmklfdlcbbafhfd
+it lbkgmmklfdkickgagnj 2
+it lbkgmmklfdkhhnbmmaa
+it lbkgmmklfdkhfjndjnc
+it lbkgmmklfdkgilffcij 2
+it lbkgmmklfdkfbjdmnie
+it lbkgmmklfdgjgfkfekc
+it lbkgmmklfdkenegddel
+it lbkgmmklfdkenabbjig 3
+it lbkgmmklfdkemldfcic 2
+it lbkgmmklfdkdnlgnaci 2
+it lbkgmmklfdkdhagmgdi 2
+it lbkgmmklfdkcjmelbej 4
+it lbkgmmklfdkaniheegb 3
+it lbkgmmklfdjnaiekinb 4
+it lbkgmmklfdjmmbhnffe
+it lbkgmmklfdjmkibamcf
+it lbkgmmklfdjmjlilhcm
+it lbkgmmklfdhaibjkcjj
+it lbkgmmklfdjmfdninnd 2
+it lbkgmmklfdjmceekmhm
+it lbkgmmklfdjmbfndcdf 2
+it lbkgmmklfdjlhccnkig 3
+it lbkgmmklfdjkeamgkig 3
+it lbkgmmklfdjjnlfnlaa 4
+it lbkgmmklfdlbaenaghj
+it lbkgmmklfdjjmaebgei 2
+it lbkgmmklfdjigdnkkam 4
+it lbkgmmklfdjicbbakjj 2
+it lbkgmmklfdjhanhbkjj 4
+it lbkgmmklfdjgmjklhhm
+it lbkgmmklfdjgiggnehb 2
+it lbkgmmklfdjgfebmkle 2
+it lbkgmmklfdjdbbhemfb 3
+it lbkgmmklfdgglgkndbd
+it lbkgmmklfdjdafhbmad 2
+it lbkgmmklfdjcnelllmg 2
+it lbkgmmklfdjcbhcbhgk 3
+it lbkgmmklfdjbjkehecl 2
+it lbkgmmklfdjbjganmne 2
+it lbkgmmklfdjbimnnjba 4
+it lbkgmmklfdjbgmdcfdm 2
+it lbkgmmklfddgcecaedi
+it lbkgmmklfdjbcigffma
+it lbkgmmklfdjagkhmibi
+it lbkgmmklfdjabcnlgma
+it lbkgmmklfdingnfkkjk 3
+it lbkgmmklfdimmfflmef
+it lbkgmmklfdimfgmnjcf 3
+it lbkgmmklfdillfjcmli 2
+it lbkgmmklfdiljhbfbbb
+it lbkgmmklfdildneclae 3
+it lbkgmmklfdilbideehi 5
+it lbkgmmklfdilbggdmne
+it lbkgmmklfdikjiefmjg 3
+it lbkgmmklfdikdgahfnb 2
+it lbkgmmklfdijacifegd 2
+it lbkgmmklfdiiljafhbc
+it lbkgmmklfdacemgkeke
+it lbkgmmklfdbahcgemml
+it lbkgmmklfdihngmcdfg 2
+it lbkgmmklfdihjcljabc
+it lbkgmmklfdighffbame 4
+it lbkgmmklfdiggacfmaf 2
+it lbkgmmklfdigdhlajna 4
+it lbkgmmklfdielciagbh
+it lbkgmmklfdiekbgcnia
+it lbkgmmklfdiehmiifmn 2
+it lbkgmmklfdiegncmaih 3
+it lbkgmmklfdidkjcdhkb
+it lbkgmmklfdiddbbgieb 2
+it lbkgmmklfdicicaddbh 5
+it lbkgmmklfdicaibalni 8
+it lbkgmmklfdibjehfnjb
+it lbkgmmklfdialibnfhl
+it lbkgmmklfdiaecmflca 2
+it lbkgmmklfdhnjlhgnfj 4
+it lbkgmmklfdhnichjeeb 2
+it lbkgmmklfdhncedjifk 3
+it lbkgmmklfdhmenagbkd
+it lbkgmmklfdhkbmdgfka 3
+it lbkgmmklfdhjhllaink 2
+it lbkgmmklfdhilfnhmcd
+it lbkgmmklfdhgnjeblnh 3
+it lbkgmmklfdenlainilc
+it lbkgmmklfdhghbacald 2
+it lbkgmmklfdhgecbgiil
+it lbkgmmklfdhfaihfadl
+it lbkgmmklfdnlnhmakaa
+it lbkgmmklfdhfaihfadl
+it lbkgmmklfdglghdcafn
+it lbkgmmklfdhefefahnk 4
+it lbkgmmklfdhefbkfhem 4
+it lbkgmmklfdhebajhabj 4
+it lbkgmmklfdbnmdchaem
+it lbkgmmklfdhdlddfedf
+it lbkgmmklfdhcnnbhbhl 2
+it lbkgmmklfdhbgccnkbg
+it lbkgmmklfdhaibjkcjj
+it lbkgmmklfdjmjlilhcm
+it lbkgmmklfdgnjjbeekj 2
+it lbkgmmklfdgneceejlf 2
+it lbkgmmklfdgnahgnidh
+it lbkgmmklfdgmdjldlga 3
+it lbkgmmklfdgmcibfdjj
+it lbkgmmklfdglnlmimcb
+it lbkgmmklfdgigddmlem
+it lbkgmmklfdglghdcafn
+it lbkgmmklfdhefefahnk
+it lbkgmmklfdglghdcafn
+it lbkgmmklfdglemkkgjf 3
+it lbkgmmklfdglbdhenjf 3
+it lbkgmmklfdgknkelejm 2
+it lbkgmmklfdgkgmhgfka 2
+it lbkgmmklfdgkdeicjdb 2
+it lbkgmmklfdgkdccgimj 3
+it lbkgmmklfdgjhngnfeb 2
+it lbkgmmklfdgjgfkfekc
+it lbkgmmklfdkfbjdmnie
+it lbkgmmklfdgikmiinhm 3
+it lbkgmmklfdgihkeinmb
+it lbkgmmklfdgihfbjkam 3
+it lbkgmmklfdgigddmlem
+it lbkgmmklfdgbfcgbhfc
+it lbkgmmklfdgigddmlem 2
+it lbkgmmklfdgigcdldcd
+it lbkgmmklfdgglgkndbd 4
+it lbkgmmklfdjdafhbmad
+it lbkgmmklfdmmakkggkb
+it lbkgmmklfdgghnknlfd
+it lbkgmmklfdggfgafgig 6
+it lbkgmmklfdgffalfihl 5
+it lbkgmmklfdlgdnmaffd
+it lbkgmmklfdgfdlgafni 3
+it lbkgmmklfdgeiacnljk 3
+it lbkgmmklfdgefnejbhh 2
+it lbkgmmklfdgdmedklfh
+it lbkgmmklfdeekabjacj
+it lbkgmmklfdbganafhee
+it lbkgmmklfdgdgclemde 3
+it lbkgmmklfdgddmhijdb 2
+it lbkgmmklfdgdcacbign
+it lbkgmmklfdgdbheflli 2
+it lbkgmmklfdgcghkfjfk
+it lbkgmmklfdeekabjacj
+it lbkgmmklfdgcghkfjfk
+it lbkgmmklfdgbjefiemi 3
+it lbkgmmklfdgbjdjanen 2
+it lbkgmmklfdgbfcgbhfc 2
+it lbkgmmklfdglnlmimcb
+it lbkgmmklfdgbchfbilb
+it lbkgmmklfdgamlmggma 2
+it lbkgmmklfdfnnmkbkbf 3
+it lbkgmmklfdfnlakcijg
+it lbkgmmklfdfmjciknhh 2
+it lbkgmmklfdflfahflde 3
+it lbkgmmklfdfkfhlmjjl 3
+it lbkgmmklfdfkedbnaej
+it lbkgmmklfdfkdfbkkge 3
+it lbkgmmklfdfjfbhblec
+it lbkgmmklfdfimmbmigl 3
+it lbkgmmklfdfiffcmfmh 5
+it lbkgmmklfdfifanngle 2
+it lbkgmmklfdfhlmcefgg 4
+it lbkgmmklfdfhhheahii
+it lbkgmmklfdfglnfdhlg 5
+it lbkgmmklfdfgfhcggac 2
+it lbkgmmklfdfgdmjggjk 2
+it lbkgmmklfdffknbdhib 2
+it lbkgmmklfdffdknhjmf 2
+it lbkgmmklfdfehfankfa 2
+it lbkgmmklfdfeghnhjig
+it lbkgmmklfdcfhahakeg
+it lbkgmmklfdbhajaalnm
+it lbkgmmklfdfeghnhjig
+it lbkgmmklfdfechimljc
+it lbkgmmklfdlchfnefec
+it lbkgmmklfdfechimljc 3
+it lbkgmmklfdfcfkklbal
+it lbkgmmklfdfcffmfhem
+it lbkgmmklfdfbmldbeaa 3
+it lbkgmmklfdfbjmfmllf 3
+it lbkgmmklfdfajaibeda 2
+it lbkgmmklfdfaigbfhak 2
+it lbkgmmklfdfadhhdnal 2
+it lbkgmmklfdfacjaeacl 2
+it lbkgmmklfdfaalbgman
+it lbkgmmklfdlfgeaeahd
+it lbkgmmklfdenlainilc
+it lbkgmmklfdhgnjeblnh
+it lbkgmmklfdenhefljff 2
+it lbkgmmklfdenfgbfcbh
+it lbkgmmklfdenafaegdl 2
+it lbkgmmklfdemiicfkji 2
+it lbkgmmklfdemdiinafe 3
+it lbkgmmklfdelmkdinlg
+it lbkgmmklfdekcddfiae 4
+it lbkgmmklfdekbldhjhe 2
+it lbkgmmklfdekbembehn
+it lbkgmmklfdejjbmbhgh
+it lbkgmmklfdejfhiadbm 2
+it lbkgmmklfdejddbjfbb
+it lbkgmmklfdeigjddfkl 4
+it lbkgmmklfdehniijkfg
+it lbkgmmklfdehhkffedb 2
+it lbkgmmklfdeghhngkek 2
+it lbkgmmklfdeghhhiecg 2
+it lbkgmmklfdeflifjkjl
+it lbkgmmklfdefjgjmlem 2
+it lbkgmmklfdefjaedibm
+it lbkgmmklfdefgfiijga
+it lbkgmmklfdgcghkfjfk
+it lbkgmmklfdgdmedklfh
+it lbkgmmklfdedfndbmmc
+it lbkgmmklfdedcbeknng
+it lbkgmmklfdbkmlkhhek
+it lbkgmmklfdedcbeknng 4
+it lbkgmmklfdecnlndbla
+it lbkgmmklfdabeihfjce
+it lbkgmmklfdecnlndbla
+it lbkgmmklfdecjcijclj 6
+it lbkgmmklfdecgbeflka 2
+it lbkgmmklfdecdghlhfj 3
+it lbkgmmklfdebdclhiai
+it lbkgmmklfdeafeaiged 2
+it lbkgmmklfdeaackknmd 3
+it lbkgmmklfddnnjkbmmh
+it lbkgmmklfddnekckdeb
+it lbkgmmklfddmjnjeibb 3
+it lbkgmmklfddmchdekja 4
+it lbkgmmklfddlkedbcml 3
+it lbkgmmklfddliibgajj 2
+it lbkgmmklfddjabdjnil
+it lbkgmmklfdbnkmffbbg
+it lbkgmmklfddjabdjnil
+it lbkgmmklfddicnhkjfd
+it lbkgmmklfddibnbbide 2
+it lbkgmmklfddiajeblbl
+it lbkgmmklfdcfbbfllkh
+it lbkgmmklfddiajeblbl 3
+it lbkgmmklfddiaajhcfi 2
+it lbkgmmklfddhlmeejde 4
+it lbkgmmklfddgnikkabi
+it lbkgmmklfddgnbljbei 2
+it lbkgmmklfddgmemcnai 2
+it lbkgmmklfddgllkeafa
+it lbkgmmklfddgcecaedi 2
+it lbkgmmklfdjbcigffma
+it lbkgmmklfddgbhcehcg 2
+it lbkgmmklfddfllednjf 2
+it lbkgmmklfddedffncda 7
+it lbkgmmklfddealffegf
+it lbkgmmklfdddkejbmch 2
+it lbkgmmklfdddhjbikgn 3
+it lbkgmmklfdddbihedkm 2
+it lbkgmmklfddcnefbkia 4
+it lbkgmmklfddcgnbdkfd
+it lbkgmmklfddbdbjceaa
+it lbkgmmklfddbclnlmhh
+it lbkgmmklfddbbdbgnaf 2
+it lbkgmmklfddagianmil 2
+it lbkgmmklfddaelhfaah 2
+it lbkgmmklfddaddlbbdi
+it lbkgmmklfddabfkagdc 3
+it lbkgmmklfdcnbfdbihi 2
+it lbkgmmklfdcmijigenj 2
+it lbkgmmklfdcmcelbhai 4
+it lbkgmmklfdcmamebnel 2
+it lbkgmmklfdclmdabbbj
+it lbkgmmklfdcljibjlmn
+it lbkgmmklfdclhijgbad 2
+it lbkgmmklfdckjlfcdkj 3
+it lbkgmmklfdckihfnacd 2
+it lbkgmmklfdcjggnenhn 2
+it lbkgmmklfdmgbnhjgfm
+it lbkgmmklfdcjafdcjnl
+it lbkgmmklfdcindddfcd
+it lbkgmmklfdnidjifhfc
+it lbkgmmklfdchfgjkfhd 2
+it lbkgmmklfdcglhdhenj 3
+it lbkgmmklfdcgehldjhg 2
+it lbkgmmklfdcfhialhnh 5
+it lbkgmmklfdfeghnhjig
+it lbkgmmklfdcfglmgmgi 2
+it lbkgmmklfdcfcjfeidh
+it lbkgmmklfdcfbbfllkh 3
+it lbkgmmklfddiajeblbl
+it lbkgmmklfdcemfhbgan 2
+it lbkgmmklfdcejimdjen 2
+it lbkgmmklfdceheeiklm 3
+it lbkgmmklfdkmbkljfhn
+it lbkgmmklfdcdekjkcja 5
+it lbkgmmklfdcdajdhmgd
+it lbkgmmklfdbelbiahhe
+it lbkgmmklfdcchihnkmm 2
+it lbkgmmklfdccbncfhcj
+it lbkgmmklfdkiggnkmha
+it lbkgmmklfdcbibnknie 4
+it lbkgmmklfdcbceigccd 2
+it lbkgmmklfdcahmgmdei
+it lbkgmmklfdhdlddfedf
+it lbkgmmklfdbnmdchaem 2
+it lbkgmmklfdbnldmalhh 2
+it lbkgmmklfddjabdjnil
+it lbkgmmklfdbnkmffbbg 2
+it lbkgmmklfdbmmnblefb 2
+it lbkgmmklfdmkmkbfhhh
+it lbkgmmklfdahadgdheb
+it lbkgmmklfdbljlchlii
+it lbkgmmklfdnebjminjc
+it lbkgmmklfdbljbkhkhi 2
+it lbkgmmklfdbcajikibb
+it lbkgmmklfdbkmlkhhek 2
+it lbkgmmklfdedcbeknng
+it lbkgmmklfdbkmdhhkjg 3
+it lbkgmmklfdbkllhgggl 2
+it lbkgmmklfdbkgdgfddl 4
+it lbkgmmklfdbkeddiefi 2
+it lbkgmmklfdbjkimcafh 4
+it lbkgmmklfdbjkfdefab 4
+it lbkgmmklfdbjjkcfnag
+it lbkgmmklfdbjdkddlab 2
+it lbkgmmklfdbigahnhhl
+it lbkgmmklfdbhkakncac 2
+it lbkgmmklfdbhimedkdc 2
+it lbkgmmklfdfeghnhjig
+it lbkgmmklfdbhajaalnm
+it lbkgmmklfdbghgnajen 4
+it lbkgmmklfdbgdcikmbf 2
+it lbkgmmklfdgdjhkbhec
+it lbkgmmklfdbganafhee
+it lbkgmmklfdbgafammkg 3
+it lbkgmmklfdbfaecfnlb 3
+it lbkgmmklfdbelbiahhe
+it lbkgmmklfdcchihnkmm
+it lbkgmmklfdbejedffdm 2
+it lbkgmmklfdbclcnfjjm 3
+it lbkgmmklfdbchlmieml 3
+it lbkgmmklfdbcflfjfjg 5
+it lbkgmmklfdbljbkhkhi
+it lbkgmmklfdbcajikibb 2
+it lbkgmmklfdbcadhkgfh
+it lbkgmmklfdbbjmmdfbh
+it lbkgmmklfdailkanhfi
+it lbkgmmklfdkkjheicgm
+it lbkgmmklfdbbccadbdh
+it lbkgmmklfdbbaflaeli 2
+it lbkgmmklfdbbaafjgjl 3
+it lbkgmmklfdbamjaicle 2
+it lbkgmmklfdbahcgemml
+it lbkgmmklfdihngmcdfg
+it lbkgmmklfdbahcgemml 3
+it lbkgmmklfdbadbccmbn 2
+it lbkgmmklfdankgicadj 2
+it lbkgmmklfdanjccckfm 5
+it lbkgmmklfdanfghgilf 3
+it lbkgmmklfdanaiakchk
+it lbkgmmklfdaljececde 5
+it lbkgmmklfdalhahnhab
+it lbkgmmklfdalajmhnfd
+it lbkgmmklfdajnhiajim 2
+it lbkgmmklfdajgcmgfig 2
+it lbkgmmklfdajbglnnah 2
+it lbkgmmklfdbbiiccgfn
+it lbkgmmklfdailkanhfi 2
+it lbkgmmklfdaikjmakgf
+it lbkgmmklfdaicgnjhdd 2
+it lbkgmmklfdahmhibgna
+it lbkgmmklfdahadgdheb
+it lbkgmmklfdbljlchlii
+it lbkgmmklfdahadgdheb
+it lbkgmmklfdaejdibbmc 2
+it lbkgmmklfdaecafmgij 4
+it lbkgmmklfdaeahkefmn 2
+it lbkgmmklfdadefmebmc
+it lbkgmmklfdacmiclgem 2
+it lbkgmmklfdiiljafhbc
+it lbkgmmklfdacemgkeke 3
+it lbkgmmklfdecnlndbla
+it lbkgmmklfdabeihfjce
+it lbkgmmklfdaalilmbja 4
+it lbkgmmklfdaafnljlcf
+it lbkgmmklfdaabngfnfd 2
+it lbkgmmklfdaabeejmag 2
+it lbkgmmklfdnhigkleec
+it lbkgmmklfdngnebllad
+it lbkgmmklfdmkmkbfhhh
+it lbkgmmklfdmfmmjahnb
+it lbkgmmklfdjlhccnkig
+it lbkgmmklfdicicaddbh
+it lbkgmmklfdhdlddfedf
+it lbkgmmklfdbljbkhkhi
+it lbkgmmklfddhkfkljcm
+it lbkgmmklfdbbiiccgfn
+it lbkgmmklfdbamjaicle
+time descend
+rh lbkgmmklfdnnjicfnjn
+rh lbkgmmklfdnnjicfnjn
+rh lbkgmmklfdnnjicfnjn
+rh lbkgmmklfdnnjicfnjn
+rh lbkgmmklfdnnelljcif
+rh lbkgmmklfdnnbebigji
+rh lbkgmmklfdnlnhmakaa
+rh lbkgmmklfdnlnhmakaa
+rh lbkgmmklfdnlnhmakaa
+rh lbkgmmklfdnlnhmakaa
+rh lbkgmmklfdnlnhmakaa
+rh lbkgmmklfdnidjifhfc
+rh lbkgmmklfdnhigkleec
+rh lbkgmmklfdngnebllad
+rh lbkgmmklfdmkmkbfhhh
+rh lbkgmmklfdmfmmjahnb
+rh lbkgmmklfdjlhccnkig
+rh lbkgmmklfdicicaddbh
+rh lbkgmmklfdhdlddfedf
+rh lbkgmmklfddhkfkljcm
+rh lbkgmmklfdbbiiccgfn
+rh lbkgmmklfdbamjaicle
+size
+free
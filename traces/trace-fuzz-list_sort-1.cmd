@@ -0,0 +1,2008 @@
+# Worst case 1 for list_sort found by 'fuzz list_sort 200 1000': 8.75 comparisons/element
+# 1000 strings of 6-8 letters a-d after a prefix of 5, 50.0% distinct, unordered runs of 198, 3% swapped, seed 0xa58240daa7692357
+option fail 0
+option malloc 0
+option bench 1
+option order asc
+option gallop 0
+new
+it baadbaddacaa
+it baadbbcdaadc
+it baadbccbcbcb
+it baadbbdcaaac
+it baadbbcbcdabc
+it baadbcbbdbdbb
+it baadbaadcdb
+it baadbcaacdc
+it baadbbbaaab
+it baadbcabddcad
+it baadbcddaadbb
+it baadbdacabbba
+it baadbcabacdb
+it baadbdddddbd
+it baadbaadcdda
+it baadbadcbdd
+it baadbaddcbdd
+it baadbbaacaccb
+it baadbbdabdbbd
+it baadbababcc
+it baadbadcddaab
+it baadbdadcaca
+it baadbbccbcabd
+it baadbbccbab
+it baadbdcbaada
+it baadbbbadabbb
+it baadbbbbbabba
+it baadbacccacdc
+it baadbcdbaacc
+it baadbcabbccc
+it baadbbbadabb
+it baadbcdcddac
+it baadbcbcacb
+it baadbbadbabcc
+it baadbcdcbddba
+it baadbadadbcc
+it baadbdbbbad
+it baadbcacbaadb
+it baadbbdbabb
+it baadbbcadaacc
+it baadbdcacbbca
+it baadbccbcab
+it baadbbaadbc
+it baadbddcccbbc
+it baadbaabdab
+it baadbccdbcbab
+it baadbbcabccd
+it baadbdaaccca
+it baadbcdcccacc
+it baadbcdbbbca
+it baadbbaacaccb
+it baadbddaccc
+it baadbbbaadbb
+it baadbdcacbbca
+it baadbbcacadb
+it baadbcadbaaa
+it baadbacdcdd
+it baadbccbcab
+it baadbcbdbdc
+it baadbccdbcbab
+it baadbcdcccacc
+it baadbdcadddd
+it baadbadbccba
+it baadbdcccabcc
+it baadbcbdccadd
+it baadbabdcdcc
+it baadbcbbcdab
+it baadbccabddb
+it baadbbbbbdcad
+it baadbbccbab
+it baadbabdbdaaa
+it baadbdddcba
+it baadbdadcbaa
+it baadbadadac
+it baadbbadcab
+it baadbaaccddb
+it baadbadaccdbb
+it baadbddaccc
+it baadbaacbcdad
+it baadbadacccdb
+it baadbdadacdba
+it baadbcaadcdad
+it baadbdccdcba
+it baadbdcacbbca
+it baadbabdccbdc
+it baadbbdbcaab
+it baadbabaccdcb
+it baadbddbccac
+it baadbacbaab
+it baadbdbdbda
+it baadbbdddbc
+it baadbcbcacb
+it baadbabdbdccc
+it baadbbbbbba
+it baadbacdcdd
+it baadbbacccaa
+it baadbbbbbba
+it baadbdbbadcc
+it baadbadadbcc
+it baadbbbbbdcad
+it baadbdbcbcd
+it baadbcabddcad
+it baadbddbccac
+it baadbadabcdb
+it baadbccccca
+it baadbdbcbcdda
+it baadbdddcba
+it baadbbbdbbcca
+it baadbaabcdd
+it baadbddcbdac
+it baadbddbabbcb
+it baadbabbbdd
+it baadbbaabdb
+it baadbabaabc
+it baadbccacbbaa
+it baadbdcbccaac
+it baadbcadbaaa
+it baadbadbabda
+it baadbadcbdd
+it baadbaacabbcb
+it baadbaddbdac
+it baadbbbbbba
+it baadbbdbabdb
+it baadbddadddc
+it baadbabdccbdc
+it baadbdcbaaaa
+it baadbdbbada
+it baadbdccaabb
+it baadbabdadcdc
+it baadbcbaaaacd
+it baadbcdaccac
+it baadbbbbdcc
+it baadbbbbbba
+it baadbcacddc
+it baadbcadbaaa
+it baadbddcddadd
+it baadbbbdbbb
+it baadbcdbcac
+it baadbbcbbadba
+it baadbcbdddbca
+it baadbdacadccc
+it baadbcccdaabc
+it baadbdccaab
+it baadbcdaabca
+it baadbddaaba
+it baadbacbbbc
+it baadbbaccdbb
+it baadbdcadcaa
+it baadbdcdbcbb
+it baadbbdcddb
+it baadbacdcdd
+it baadbbbbbccdc
+it baadbdccbaa
+it baadbdacbcccc
+it baadbdcbcdcad
+it baadbdcddcca
+it baadbcaadaa
+it baadbdbbbad
+it baadbadddaaca
+it baadbddabab
+it baadbadacccdb
+it baadbddccaabc
+it baadbbdaabaaa
+it baadbacbcab
+it baadbccdccdda
+it baadbacaaabb
+it baadbdcadbad
+it baadbaabcaa
+it baadbbcbdcdab
+it baadbbcbabdcb
+it baadbbcbdcdab
+it baadbacbbdb
+it baadbbcdaadc
+it baadbbbadabbb
+it baadbddcdddcd
+it baadbacdcbbcc
+it baadbcabbccc
+it baadbbbdcdc
+it baadbadbccbbb
+it baadbbcdbdd
+it baadbdaddacd
+it baadbdcadcaa
+it baadbbdaabaaa
+it baadbbcbacacc
+it baadbbdbabb
+it baadbacbaadb
+it baadbbadcacd
+it baadbaaaaacdd
+it baadbacbcab
+it baadbdbddabcd
+it baadbadbbacc
+it baadbbadcac
+it baadbdbabbc
+it baadbbdbccab
+it baadbdcacaac
+it baadbbdbabb
+it baadbbbabccc
+it baadbbadcacd
+it baadbacdcca
+it baadbbbdbbb
+it baadbdbadcbdc
+it baadbadcddcca
+it baadbcdcaaadc
+it baadbdaaccca
+it baadbdacbad
+it baadbddbabdcb
+it baadbdccaabb
+it baadbbbbbbab
+it baadbddaabc
+it baadbaacdaa
+it baadbddaaba
+it baadbccbacc
+it baadbbcdbbb
+it baadbacdcdd
+it baadbdacdabbd
+it baadbbbdbbb
+it baadbbadcab
+it baadbcaacdc
+it baadbcdbbabcb
+it baadbdadcaca
+it baadbbadcdca
+it baadbdddcba
+it baadbadcbdd
+it baadbadbccba
+it baadbdcadddd
+it baadbabdbbdb
+it baadbacbdbaa
+it baadbccaccdad
+it baadbddbdbdac
+it baadbbbbdbd
+it baadbcbdbcdd
+it baadbadabcaaa
+it baadbdbbdddda
+it baadbcbdcab
+it baadbaadbabbc
+it baadbabbaca 2
+it baadbdaabdc
+it baadbdbabbc
+it baadbcdbbabcb
+it baadbadcddcca
+it baadbbbdbbb
+it baadbdccdcba
+it baadbdbbadcc
+it baadbadcbdd
+it baadbcaabda
+it baadbbbaadd
+it baadbacbbbc
+it baadbadddaad
+it baadbdbbada
+it baadbbdcbcd
+it baadbbbdadc
+it baadbccaaab
+it baadbcaacdbc
+it baadbdabdac
+it baadbdcbdadbd
+it baadbdabdaccb
+it baadbdcadbad
+it baadbbccbab
+it baadbbcdacdb
+it baadbddbabdcb
+it baadbbbccdb
+it baadbbdcaaac
+it baadbcbadcdbc
+it baadbababddba
+it baadbbabbbd
+it baadbabdabbc
+it baadbddcdddcd
+it baadbddaaba
+it baadbacacabda
+it baadbbbbadda
+it baadbbbaadbb
+it baadbdcdbdb
+it baadbbacdca 2
+it baadbabdbdc
+it baadbdcbbabaa
+it baadbbacdcbc
+it baadbcccdaabc
+it baadbcbdddbca
+it baadbccabddb
+it baadbcabacdb
+it baadbcabddcad
+it baadbbbaadd
+it baadbbaccdbb
+it baadbbbccabc
+it baadbcdaddaa
+it baadbddbdbdac
+it baadbccdbcbab
+it baadbbcaddab
+it baadbdaaccca
+it baadbcbaaaacd
+it baadbbacccaa
+it baadbbaacbcc
+it baadbdaacbdac
+it baadbcdaddaa
+it baadbdcddcca
+it baadbcaadaa
+it baadbbdbcaab
+it baadbcdaabbca
+it baadbbbadabbb
+it baadbaadcdda
+it baadbabbaca
+it baadbddbaaa
+it baadbadddaaca
+it baadbcbdddbca
+it baadbaaccdca
+it baadbaacbcdad
+it baadbdbcadbda
+it baadbdbbadcc
+it baadbbacbddbd
+it baadbbcacadb
+it baadbdcadbad
+it baadbcbadacdc
+it baadbddcbdac
+it baadbaaadccbc
+it baadbbddacdb
+it baadbaddbdac
+it baadbacacabda
+it baadbbbbdbd
+it baadbdccbcaba
+it baadbbbbbbab
+it baadbdacbcccc
+it baadbcdcadbd
+it baadbaaccdca
+it baadbadcabaac
+it baadbcdcddac
+it baadbccbcab
+it baadbaaaaacdd
+it baadbddcbdac
+it baadbdbcabad
+it baadbbaadbc
+it baadbaaadccbc
+it baadbbcbccbbc
+it baadbcbadcdbc
+it baadbbcbabdcb
+it baadbbdababcc
+it baadbaaccdca
+it baadbadbabda 2
+it baadbbbaaab
+it baadbdccdad
+it baadbccdbcbab
+it baadbbadcac
+it baadbbcbbadba
+it baadbcaabcd
+it baadbbabdab
+it baadbbdbccab
+it baadbbccdbcdd
+it baadbccbcbcb
+it baadbbcdbbb
+it baadbdcdbdb
+it baadbabdcbcc
+it baadbccaaab
+it baadbbbaaab
+it baadbdccbbb
+it baadbdabdac
+it baadbabbcdbb
+it baadbcbbcdab
+it baadbbccaaa
+it baadbcdbadda
+it baadbddbaccd
+it baadbbcdbbb
+it baadbbbcbbb
+it baadbcacbaadb
+it baadbaadcdda
+it baadbdacbcccc
+it baadbbdabdbbd
+it baadbcabddcad
+it baadbabdbdddc
+it baadbccbbcadc
+it baadbdacbad
+it baadbdcdcdbd
+it baadbaadcdb
+it baadbcaddbcab
+it baadbbdbcaab
+it baadbccdbbad
+it baadbbbbbabba
+it baadbbcbcdabc
+it baadbccadadb
+it baadbcaabda
+it baadbcddaabbd
+it baadbcbbcbab
+it baadbacbdbaa
+it baadbaadbbabd
+it baadbaaadccbc
+it baadbabadbca
+it baadbdbacdb
+it baadbbccbcabd
+it baadbbcbacacc
+it baadbcdddaab
+it baadbabdbaad
+it baadbcdcddac
+it baadbbacbddbd
+it baadbabdbdaaa
+it baadbbccbab
+it baadbcbcacb
+it baadbaccbdcad
+it baadbddadddc
+it baadbbcaaba
+it baadbdddcba
+it baadbbbabccc
+it baadbadcddaab
+it baadbaddcada
+it baadbdbcabb
+it baadbaabadabb
+it baadbbbdbbb
+it baadbdbadcbdc
+it baadbabdbbdb
+it baadbbbabbdaa
+it baadbbcbacdc
+it baadbcdbadda
+it baadbdaaabbb
+it baadbcccadaa
+it baadbbbbcbcaa
+it baadbccdccdda
+it baadbbaacbcc
+it baadbcbbbaab
+it baadbdacabbba
+it baadbbcccaa
+it baadbdcccabcc
+it baadbbdcdaccb
+it baadbcbdbca
+it baadbdbcbda
+it baadbcdaadd
+it baadbdcadddd
+it baadbddabab
+it baadbbaaddcda
+it baadbdcbaaaa
+it baadbdccbdbdc
+it baadbbbadbaa
+it baadbdccbbb
+it baadbaaddbcdb
+it baadbcaddbcab
+it baadbdcdcdbd
+it baadbbacdcca
+it baadbbcccacaa
+it baadbdbbcacaa
+it baadbacccacdc
+it baadbcbdddbca
+it baadbbbbbabba
+it baadbccbbcadc
+it baadbddccaabc
+it baadbbdbdbb
+it baadbcbdbdc
+it baadbcdcddac
+it baadbdccbcaba
+it baadbacdcdd
+it baadbaccddd
+it baadbbdabacca
+it baadbaadccb
+it baadbbcadaacc
+it baadbcabbadbd
+it baadbadadbcc
+it baadbabbccb
+it baadbdbcbdbdd
+it baadbbddcbbdd
+it baadbcaabcd
+it baadbadbabda
+it baadbdcdcdbd
+it baadbddbabbcb
+it baadbddbabdcb
+it baadbabdccbdc
+it baadbabdbbdb
+it baadbadcddcca
+it baadbabdbdc
+it baadbbadcab
+it baadbaddacaa
+it baadbdccccc
+it baadbcabdbbc
+it baadbddaaba
+it baadbbbabccc
+it baadbccdccdda
+it baadbdcaccad
+it baadbaabacdb
+it baadbabdbdaaa
+it baadbddcbdac
+it baadbdbcbaac
+it baadbacbcab
+it baadbadddaaca
+it baadbdddddbd
+it baadbbbbbdcad
+it baadbabdbdddc
+it baadbbbaadd
+it baadbdbcdac
+it baadbadcbdd
+it baadbabdbdccc
+it baadbcbdbdc
+it baadbbbdbbcca
+it baadbdcbdadbd
+it baadbdaacbdac
+it baadbdcccabcd
+it baadbdacaabca
+it baadbbcadaacc
+it baadbadaccdbb
+it baadbcaaaccca
+it baadbabdcddd
+it baadbdccabdaa
+it baadbdddcba
+it baadbcbabadbd
+it baadbcddbbab
+it baadbdadcaca
+it baadbdbbcacaa
+it baadbddcbdac
+it baadbaabdaa
+it baadbbdaccdaa
+it baadbadaccabb
+it baadbbcbacacc
+it baadbdccaabb
+it baadbadaadbcc
+it baadbdccabdaa
+it baadbbcabaaca
+it baadbaabacdb
+it baadbbadbabcc
+it baadbcdcbddba
+it baadbbdbcaab
+it baadbcbadacdc
+it baadbbdadbdb
+it baadbddbaccd
+it baadbaaccdca
+it baadbaabdaa
+it baadbadabacd
+it baadbcaacad
+it baadbcccbdc
+it baadbbadcdca
+it baadbadcbca
+it baadbababcc
+it baadbbbbadda
+it baadbcdddaab
+it baadbbcaaba
+it baadbdabcdc
+it baadbdabaad
+it baadbcdcadbd
+it baadbccccca
+it baadbdcaccad
+it baadbaacabbcb
+it baadbadbccba
+it baadbaaaaacdd
+it baadbdbacdadb
+it baadbacdcca
+it baadbbbbcbcaa
+it baadbbcbcdabc
+it baadbbddacdb
+it baadbdddcbacd
+it baadbcaaccd
+it baadbdbbada
+it baadbbbdcaacb
+it baadbbabdab
+it baadbdbcbcd
+it baadbbdcbcd
+it baadbbdddbc
+it baadbcbdbcdd
+it baadbcbacbcb
+it baadbcbbcdab
+it baadbaaaaacdd
+it baadbaddbdd
+it baadbcdcdbdbd
+it baadbabbbbdbc
+it baadbcdbbabcb
+it baadbbcccaa
+it baadbcdbaacc
+it baadbacadaacb
+it baadbcbadbd
+it baadbbddcbbdd
+it baadbbacdcca
+it baadbcdaabca
+it baadbbdbbbb
+it baadbaabcbcdd
+it baadbdcadcaa
+it baadbddaaba
+it baadbcdbaacc
+it baadbadadac
+it baadbbddacdb
+it baadbaddcbdd
+it baadbbbbddbba
+it baadbbccdbaab
+it baadbadcbdd
+it baadbaabcbcdd
+it baadbbbbcbbb
+it baadbdabdaccb
+it baadbdcadbad
+it baadbbabadcdb
+it baadbddaccc
+it baadbdcdbbda
+it baadbcbdcab
+it baadbbacdca
+it baadbbbbddbba
+it baadbbccaabd
+it baadbacdaaaca
+it baadbbbdcdc
+it baadbbcbdaab
+it baadbbdcccc
+it baadbcbdbbabd
+it baadbbaaddcda
+it baadbdcdbbda
+it baadbbdbadcc
+it baadbbbdbbcca
+it baadbcdabdbbc
+it baadbddabdb
+it baadbdcddcca
+it baadbbbbaadc
+it baadbaabbccb
+it baadbcddbbab
+it baadbcdacacad
+it baadbbcddcbab
+it baadbdccaabb
+it baadbdcbbaaaa
+it baadbbddcbbdd
+it baadbdbdbda
+it baadbbadbabcc
+it baadbacbcad
+it baadbdbdbdaa
+it baadbbbaaca
+it baadbaabbabb
+it baadbbcbdaab
+it baadbabbadddc
+it baadbdccdad
+it baadbaadccb
+it baadbcbdbbabd
+it baadbdcdcdbd
+it baadbbbbcbbb
+it baadbdcdbdb
+it baadbddbccac
+it baadbacdaaaca
+it baadbcccbdc
+it baadbccdcaba
+it baadbabbaca
+it baadbbdababcc
+it baadbcccccd
+it baadbdbacbca
+it baadbaaaaacdd
+it baadbabdccbdc
+it baadbbbccabdc
+it baadbddaaba
+it baadbacadab
+it baadbaccddd
+it baadbccbbcadc
+it baadbdabcbbcd
+it baadbdccbaa
+it baadbccdbcbab
+it baadbadcddaab
+it baadbaaccca
+it baadbadaccdbb
+it baadbadabcdb
+it baadbbbadabbb
+it baadbbacbddbd
+it baadbcdbbbd
+it baadbdadcbaa
+it baadbddcccbbc
+it baadbbcdacdb
+it baadbcacabc
+it baadbacadaacb
+it baadbdbcbdbdd
+it baadbbacdcca
+it baadbadbccbbb
+it baadbbbbadda
+it baadbcbbbaab
+it baadbbcaaba
+it baadbabbcadb
+it baadbdcddbbcd
+it baadbccbacc
+it baadbbbbbccdc
+it baadbcdaadbc
+it baadbddabab
+it baadbadabacd
+it baadbcbbbaab
+it baadbaacbcdad
+it baadbadabacd
+it baadbdcaacbda
+it baadbbdcddcb
+it baadbbbcbbb
+it baadbccaaab
+it baadbdbbada
+it baadbdcacbbca
+it baadbbbaaab
+it baadbbccbcabd
+it baadbaabadabb
+it baadbbbadabbb
+it baadbbbadabb
+it baadbadddaad
+it baadbbdccdcb
+it baadbaaadccbc
+it baadbcaaaccca
+it baadbcbcacb
+it baadbcbdbcdd
+it baadbaabdcca
+it baadbccacbbaa
+it baadbbadbabcc
+it baadbbbbcbbb
+it baadbcaacdc
+it baadbadccaa
+it baadbdbacbca
+it baadbaadcbadc
+it baadbdbbcbcd
+it baadbadbbacc
+it baadbbdbccab
+it baadbdbbabbdc
+it baadbadcbca
+it baadbaaadccbc
+it baadbdbbabbdc
+it baadbdccbcaba
+it baadbaacdaa
+it baadbabcdabb
+it baadbbbbbbda
+it baadbaddcada
+it baadbadadcaa
+it baadbadccaa
+it baadbdbbaaddb
+it baadbdbabbc
+it baadbaddcada
+it baadbaabdaa
+it baadbdccdcba
+it baadbccacbbaa
+it baadbaabadabb
+it baadbbcaddab
+it baadbbaacaccb
+it baadbbbabccc
+it baadbdcbaada
+it baadbadaccdbb
+it baadbbcbacacc
+it baadbdcbbabaa
+it baadbadbdabb
+it baadbbaadbaba
+it baadbbadaada
+it baadbbdcbcd
+it baadbddbabdcb
+it baadbdccbbb
+it baadbdabaad
+it baadbdacaabca
+it baadbabdbdaaa
+it baadbbacdca
+it baadbccdbcbab
+it baadbcbbcbab
+it baadbbccbab
+it baadbaacabbcb
+it baadbbccbab
+it baadbcabddcad
+it baadbcdaabca
+it baadbbccdbaab
+it baadbadbbacc
+it baadbdbdbcdd
+it baadbdbbcacaa
+it baadbbbcdab
+it baadbcdcdbdbd
+it baadbbacbddbd
+it baadbbbadbaa
+it baadbabdbdddc
+it baadbdbddabcd
+it baadbbaadcba
+it baadbadadcaa
+it baadbbacdcbc
+it baadbaabcbcdd
+it baadbdacdabbd
+it baadbdbcabb
+it baadbdcdddba
+it baadbddcbdac
+it baadbdadddcb
+it baadbbbbbbab
+it baadbbdaccdaa
+it baadbdaaabbb
+it baadbccbcab
+it baadbbcbdbbda
+it baadbcccccd
+it baadbbcaacc
+it baadbaadccca
+it baadbdcaccad
+it baadbbaaddcda
+it baadbdcaccad
+it baadbcccbdc
+it baadbbadaada
+it baadbdadcbb
+it baadbdcdabcb
+it baadbcdbbbd
+it baadbaacbcdad
+it baadbcbdbca
+it baadbcdbcac
+it baadbcbcdca
+it baadbbddacdb
+it baadbacdcca
+it baadbdddddbd
+it baadbccdbbdab
+it baadbdabcdc
+it baadbadcabaac
+it baadbcababdbc
+it baadbadadccb
+it baadbcbdbca
+it baadbcbcbadd
+it baadbadabacd
+it baadbdbdbda
+it baadbdcacbbca
+it baadbbdbabdb
+it baadbcdbbabcb
+it baadbacccacdc
+it baadbaccbdcad
+it baadbcadbaaa
+it baadbbbaabdd
+it baadbaadcbadc
+it baadbbaacaccb
+it baadbbaccdbb
+it baadbbcdbdd
+it baadbdaabdc
+it baadbcaddbbb
+it baadbdcbcdcad
+it baadbccdbcbab
+it baadbdbbcacaa
+it baadbaaaaacdd
+it baadbddccaabc
+it baadbccbcab
+it baadbadbccbbb
+it baadbcabacdb
+it baadbaddbddb
+it baadbbdcccc
+it baadbdbcbcdda
+it baadbbbabccc
+it baadbaabbabb
+it baadbadaaba
+it baadbcacabc
+it baadbdcdddba
+it baadbacbcdb
+it baadbdabcdc
+it baadbbcdbdd
+it baadbcbdbcdd
+it baadbaaccca
+it baadbdabbcbca
+it baadbbcbaabc
+it baadbcabddcad
+it baadbadaccdbb
+it baadbbbbcbbb
+it baadbcdbaacc
+it baadbcdcaacc
+it baadbdabdaccb
+it baadbabdbaad
+it baadbabaccdcb
+it baadbbccaabd
+it baadbcacbaadb
+it baadbcdddaab
+it baadbcdaccac
+it baadbdcadddc
+it baadbdcbacd
+it baadbbbabccc
+it baadbbaccdbb
+it baadbaadbabbc
+it baadbcddaadbb
+it baadbaabcbcdd
+it baadbaaccca
+it baadbabcdabb
+it baadbcabddcad
+it baadbbdabdbbd
+it baadbbdccdcb
+it baadbdaacbdac
+it baadbcbdbca
+it baadbadadbcc
+it baadbcbdbca
+it baadbbcbaabc
+it baadbbcbcdabc
+it baadbaabcbcdd
+it baadbddaaba
+it baadbabbaca
+it baadbcdabdbbc
+it baadbcbbcdab
+it baadbcccadaa
+it baadbdacaabca
+it baadbcbbdbbd
+it baadbbdbadcc
+it baadbadadac
+it baadbcabdcbb
+it baadbcbdcab
+it baadbcdcadbd
+it baadbaddbaa
+it baadbacaddbc
+it baadbdcadcaa
+it baadbbcbdaab
+it baadbbbbdcc
+it baadbcabdddb
+it baadbaacbcdad
+it baadbbaacaccb
+it baadbaccbdcad
+it baadbcddaabbd
+it baadbdadddb
+it baadbcddaadbb
+it baadbddabab
+it baadbdbbadcc
+it baadbccaccdad
+it baadbaaccdca
+it baadbdaaabbb
+it baadbdcbaada
+it baadbccabddb
+it baadbdadcbb
+it baadbcabdddb
+it baadbbbdadc
+it baadbbbaabdd
+it baadbdccbaa
+it baadbaaacaada
+it baadbadadccb
+it baadbdddcba
+it baadbaadbabbc
+it baadbadddaad
+it baadbdbbadcc
+it baadbaacbcdad
+it baadbbccbab
+it baadbaccbdcad
+it baadbadccbb
+it baadbabdcddd
+it baadbadccaa
+it baadbbabccba
+it baadbddcbaa
+it baadbdabdaccb
+it baadbacacabda
+it baadbacbaab
+it baadbcaaccd
+it baadbdbacdadb
+it baadbbbaadcd
+it baadbdcdbbda
+it baadbbcdacdb
+it baadbbbdbbcca
+it baadbcacddc
+it baadbbbbbbda
+it baadbddccaabc
+it baadbcbacbc
+it baadbabdbdc
+it baadbcbacbcb
+it baadbcdbddcdb
+it baadbdbcccb
+it baadbbcbabdcb
+it baadbaddbdac
+it baadbbdbabdb
+it baadbdadddcb
+it baadbbaaddcda
+it baadbbbbddbba
+it baadbbbbbba
+it baadbacaddbc
+it baadbdadddb
+it baadbaadcdda
+it baadbaaccca
+it baadbcacabc
+it baadbdcdcccd
+it baadbddbaccd
+it baadbbcbdaab
+it baadbcaaaccca
+it baadbbcbaabc
+it baadbabbcda
+it baadbccbacc
+it baadbadccbb
+it baadbdabdaccb
+it baadbcdcbbd
+it baadbcadcdbba
+it baadbbcaabddc
+it baadbcdbaacc
+it baadbddaabc
+it baadbcbdbdc
+it baadbcdaabbca
+it baadbcddbdca
+it baadbdbbbdac
+it baadbdbcccb
+it baadbcaacdbc
+it baadbbcbacdc
+it baadbccadadb
+it baadbadabacd
+it baadbabdbdc
+it baadbdccbdbdc
+it baadbbadcacd
+it baadbdabcbcd
+it baadbcdcbbd
+it baadbcabdcbb
+it baadbadccbb
+it baadbbacccaa
+it baadbcdbadda
+it baadbaddacaa
+it baadbcadbaaa
+it baadbcdcaacc
+it baadbbbbbbda
+it baadbddbaaa
+it baadbdcbccaac
+it baadbcaabcd
+it baadbdacbbd
+it baadbdbcbcdda
+it baadbbcaccc
+it baadbaddcada
+it baadbbcbdbbda
+it baadbbdababcc
+it baadbcbcacb
+it baadbdbbaaddb
+it baadbbbbddbba
+it baadbdbcabb
+it baadbbdbbbb
+it baadbdbcccb
+it baadbaabcdd
+it baadbbbbbcd
+it baadbbcabccd
+it baadbdacabbba
+it baadbdabcbcd
+it baadbbcddbc
+it baadbcdacacad
+it baadbbccdbaab
+it baadbadadccb
+it baadbadabacd
+it baadbbcbaabc
+it baadbbadcab
+it baadbcddaadbb
+it baadbcdcaacc
+list_sort
+rh baadbaaaaacdd
+rh baadbaaaaacdd
+rh baadbaaaaacdd
+rh baadbaaaaacdd
+rh baadbaaaaacdd
+rh baadbaaaaacdd
+rh baadbaaacaada
+rh baadbaaadccbc
+rh baadbaaadccbc
+rh baadbaaadccbc
+rh baadbaaadccbc
+rh baadbaaadccbc
+rh baadbaabacdb
+rh baadbaabacdb
+rh baadbaabadabb
+rh baadbaabadabb
+rh baadbaabadabb
+rh baadbaabbabb
+rh baadbaabbabb
+rh baadbaabbccb
+rh baadbaabcaa
+rh baadbaabcbcdd
+rh baadbaabcbcdd
+rh baadbaabcbcdd
+rh baadbaabcbcdd
+rh baadbaabcbcdd
+rh baadbaabcdd
+rh baadbaabcdd
+rh baadbaabdaa
+rh baadbaabdaa
+rh baadbaabdaa
+rh baadbaabdab
+rh baadbaabdcca
+rh baadbaacabbcb
+rh baadbaacabbcb
+rh baadbaacabbcb
+rh baadbaacbcdad
+rh baadbaacbcdad
+rh baadbaacbcdad
+rh baadbaacbcdad
+rh baadbaacbcdad
+rh baadbaacbcdad
+rh baadbaaccca
+rh baadbaaccca
+rh baadbaaccca
+rh baadbaaccca
+rh baadbaaccdca
+rh baadbaaccdca
+rh baadbaaccdca
+rh baadbaaccdca
+rh baadbaaccdca
+rh baadbaaccddb
+rh baadbaacdaa
+rh baadbaacdaa
+rh baadbaadbabbc
+rh baadbaadbabbc
+rh baadbaadbabbc
+rh baadbaadbbabd
+rh baadbaadcbadc
+rh baadbaadcbadc
+rh baadbaadccb
+rh baadbaadccb
+rh baadbaadccca
+rh baadbaadcdb
+rh baadbaadcdb
+rh baadbaadcdda
+rh baadbaadcdda
+rh baadbaadcdda
+rh baadbaadcdda
+rh baadbaaddbcdb
+rh baadbabaabc
+rh baadbababcc
+rh baadbababcc
+rh baadbababddba
+rh baadbabaccdcb
+rh baadbabaccdcb
+rh baadbabadbca
+rh baadbabbaca
+rh baadbabbaca
+rh baadbabbaca
+rh baadbabbaca
+rh baadbabbaca
+rh baadbabbadddc
+rh baadbabbbbdbc
+rh baadbabbbdd
+rh baadbabbcadb
+rh baadbabbccb
+rh baadbabbcda
+rh baadbabbcdbb
+rh baadbabcdabb
+rh baadbabcdabb
+rh baadbabdabbc
+rh baadbabdadcdc
+rh baadbabdbaad
+rh baadbabdbaad
+rh baadbabdbbdb
+rh baadbabdbbdb
+rh baadbabdbbdb
+rh baadbabdbdaaa
+rh baadbabdbdaaa
+rh baadbabdbdaaa
+rh baadbabdbdaaa
+rh baadbabdbdc
+rh baadbabdbdc
+rh baadbabdbdc
+rh baadbabdbdc
+rh baadbabdbdccc
+rh baadbabdbdccc
+rh baadbabdbdddc
+rh baadbabdbdddc
+rh baadbabdbdddc
+rh baadbabdcbcc
+rh baadbabdccbdc
+rh baadbabdccbdc
+rh baadbabdccbdc
+rh baadbabdccbdc
+rh baadbabdcdcc
+rh baadbabdcddd
+rh baadbabdcddd
+rh baadbacaaabb
+rh baadbacacabda
+rh baadbacacabda
+rh baadbacacabda
+rh baadbacadaacb
+rh baadbacadaacb
+rh baadbacadab
+rh baadbacaddbc
+rh baadbacaddbc
+rh baadbacbaab
+rh baadbacbaab
+rh baadbacbaadb
+rh baadbacbbbc
+rh baadbacbbbc
+rh baadbacbbdb
+rh baadbacbcab
+rh baadbacbcab
+rh baadbacbcab
+rh baadbacbcad
+rh baadbacbcdb
+rh baadbacbdbaa
+rh baadbacbdbaa
+rh baadbaccbdcad
+rh baadbaccbdcad
+rh baadbaccbdcad
+rh baadbaccbdcad
+rh baadbacccacdc
+rh baadbacccacdc
+rh baadbacccacdc
+rh baadbaccddd
+rh baadbaccddd
+rh baadbacdaaaca
+rh baadbacdaaaca
+rh baadbacdcbbcc
+rh baadbacdcca
+rh baadbacdcca
+rh baadbacdcca
+rh baadbacdcdd
+rh baadbacdcdd
+rh baadbacdcdd
+rh baadbacdcdd
+rh baadbacdcdd
+rh baadbadaaba
+rh baadbadaadbcc
+rh baadbadabacd
+rh baadbadabacd
+rh baadbadabacd
+rh baadbadabacd
+rh baadbadabacd
+rh baadbadabacd
+rh baadbadabcaaa
+rh baadbadabcdb
+rh baadbadabcdb
+rh baadbadaccabb
+rh baadbadacccdb
+rh baadbadacccdb
+rh baadbadaccdbb
+rh baadbadaccdbb
+rh baadbadaccdbb
+rh baadbadaccdbb
+rh baadbadaccdbb
+rh baadbadadac
+rh baadbadadac
+rh baadbadadac
+rh baadbadadbcc
+rh baadbadadbcc
+rh baadbadadbcc
+rh baadbadadbcc
+rh baadbadadcaa
+rh baadbadadcaa
+rh baadbadadccb
+rh baadbadadccb
+rh baadbadadccb
+rh baadbadbabda
+rh baadbadbabda
+rh baadbadbabda
+rh baadbadbabda
+rh baadbadbbacc
+rh baadbadbbacc
+rh baadbadbbacc
+rh baadbadbccba
+rh baadbadbccba
+rh baadbadbccba
+rh baadbadbccbbb
+rh baadbadbccbbb
+rh baadbadbccbbb
+rh baadbadbdabb
+rh baadbadcabaac
+rh baadbadcabaac
+rh baadbadcbca
+rh baadbadcbca
+rh baadbadcbdd
+rh baadbadcbdd
+rh baadbadcbdd
+rh baadbadcbdd
+rh baadbadcbdd
+rh baadbadcbdd
+rh baadbadccaa
+rh baadbadccaa
+rh baadbadccaa
+rh baadbadccbb
+rh baadbadccbb
+rh baadbadccbb
+rh baadbadcddaab
+rh baadbadcddaab
+rh baadbadcddaab
+rh baadbadcddcca
+rh baadbadcddcca
+rh baadbadcddcca
+rh baadbaddacaa
+rh baadbaddacaa
+rh baadbaddacaa
+rh baadbaddbaa
+rh baadbaddbdac
+rh baadbaddbdac
+rh baadbaddbdac
+rh baadbaddbdd
+rh baadbaddbddb
+rh baadbaddcada
+rh baadbaddcada
+rh baadbaddcada
+rh baadbaddcada
+rh baadbaddcbdd
+rh baadbaddcbdd
+rh baadbadddaaca
+rh baadbadddaaca
+rh baadbadddaaca
+rh baadbadddaad
+rh baadbadddaad
+rh baadbadddaad
+rh baadbbaabdb
+rh baadbbaacaccb
+rh baadbbaacaccb
+rh baadbbaacaccb
+rh baadbbaacaccb
+rh baadbbaacaccb
+rh baadbbaacbcc
+rh baadbbaacbcc
+rh baadbbaadbaba
+rh baadbbaadbc
+rh baadbbaadbc
+rh baadbbaadcba
+rh baadbbaaddcda
+rh baadbbaaddcda
+rh baadbbaaddcda
+rh baadbbaaddcda
+rh baadbbabadcdb
+rh baadbbabbbd
+rh baadbbabccba
+rh baadbbabdab
+rh baadbbabdab
+rh baadbbacbddbd
+rh baadbbacbddbd
+rh baadbbacbddbd
+rh baadbbacbddbd
+rh baadbbacccaa
+rh baadbbacccaa
+rh baadbbacccaa
+rh baadbbaccdbb
+rh baadbbaccdbb
+rh baadbbaccdbb
+rh baadbbaccdbb
+rh baadbbacdca
+rh baadbbacdca
+rh baadbbacdca
+rh baadbbacdca
+rh baadbbacdcbc
+rh baadbbacdcbc
+rh baadbbacdcca
+rh baadbbacdcca
+rh baadbbacdcca
+rh baadbbadaada
+rh baadbbadaada
+rh baadbbadbabcc
+rh baadbbadbabcc
+rh baadbbadbabcc
+rh baadbbadbabcc
+rh baadbbadcab
+rh baadbbadcab
+rh baadbbadcab
+rh baadbbadcab
+rh baadbbadcac
+rh baadbbadcac
+rh baadbbadcacd
+rh baadbbadcacd
+rh baadbbadcacd
+rh baadbbadcdca
+rh baadbbadcdca
+rh baadbbbaaab
+rh baadbbbaaab
+rh baadbbbaaab
+rh baadbbbaaab
+rh baadbbbaabdd
+rh baadbbbaabdd
+rh baadbbbaaca
+rh baadbbbaadbb
+rh baadbbbaadbb
+rh baadbbbaadcd
+rh baadbbbaadd
+rh baadbbbaadd
+rh baadbbbaadd
+rh baadbbbabbdaa
+rh baadbbbabccc
+rh baadbbbabccc
+rh baadbbbabccc
+rh baadbbbabccc
+rh baadbbbabccc
+rh baadbbbabccc
+rh baadbbbadabb
+rh baadbbbadabb
+rh baadbbbadabbb
+rh baadbbbadabbb
+rh baadbbbadabbb
+rh baadbbbadabbb
+rh baadbbbadabbb
+rh baadbbbadbaa
+rh baadbbbadbaa
+rh baadbbbbaadc
+rh baadbbbbadda
+rh baadbbbbadda
+rh baadbbbbadda
+rh baadbbbbbabba
+rh baadbbbbbabba
+rh baadbbbbbabba
+rh baadbbbbbba
+rh baadbbbbbba
+rh baadbbbbbba
+rh baadbbbbbba
+rh baadbbbbbba
+rh baadbbbbbbab
+rh baadbbbbbbab
+rh baadbbbbbbab
+rh baadbbbbbbda
+rh baadbbbbbbda
+rh baadbbbbbbda
+rh baadbbbbbccdc
+rh baadbbbbbccdc
+rh baadbbbbbcd
+rh baadbbbbbdcad
+rh baadbbbbbdcad
+rh baadbbbbbdcad
+rh baadbbbbcbbb
+rh baadbbbbcbbb
+rh baadbbbbcbbb
+rh baadbbbbcbbb
+rh baadbbbbcbcaa
+rh baadbbbbcbcaa
+rh baadbbbbdbd
+rh baadbbbbdbd
+rh baadbbbbdcc
+rh baadbbbbdcc
+rh baadbbbbddbba
+rh baadbbbbddbba
+rh baadbbbbddbba
+rh baadbbbbddbba
+rh baadbbbcbbb
+rh baadbbbcbbb
+rh baadbbbccabc
+rh baadbbbccabdc
+rh baadbbbccdb
+rh baadbbbcdab
+rh baadbbbdadc
+rh baadbbbdadc
+rh baadbbbdbbb
+rh baadbbbdbbb
+rh baadbbbdbbb
+rh baadbbbdbbb
+rh baadbbbdbbb
+rh baadbbbdbbcca
+rh baadbbbdbbcca
+rh baadbbbdbbcca
+rh baadbbbdbbcca
+rh baadbbbdcaacb
+rh baadbbbdcdc
+rh baadbbbdcdc
+rh baadbbcaaba
+rh baadbbcaaba
+rh baadbbcaaba
+rh baadbbcaabddc
+rh baadbbcaacc
+rh baadbbcabaaca
+rh baadbbcabccd
+rh baadbbcabccd
+rh baadbbcacadb
+rh baadbbcacadb
+rh baadbbcaccc
+rh baadbbcadaacc
+rh baadbbcadaacc
+rh baadbbcadaacc
+rh baadbbcaddab
+rh baadbbcaddab
+rh baadbbcbaabc
+rh baadbbcbaabc
+rh baadbbcbaabc
+rh baadbbcbaabc
+rh baadbbcbabdcb
+rh baadbbcbabdcb
+rh baadbbcbabdcb
+rh baadbbcbacacc
+rh baadbbcbacacc
+rh baadbbcbacacc
+rh baadbbcbacacc
+rh baadbbcbacdc
+rh baadbbcbacdc
+rh baadbbcbbadba
+rh baadbbcbbadba
+rh baadbbcbccbbc
+rh baadbbcbcdabc
+rh baadbbcbcdabc
+rh baadbbcbcdabc
+rh baadbbcbcdabc
+rh baadbbcbdaab
+rh baadbbcbdaab
+rh baadbbcbdaab
+rh baadbbcbdaab
+rh baadbbcbdbbda
+rh baadbbcbdbbda
+rh baadbbcbdcdab
+rh baadbbcbdcdab
+rh baadbbccaaa
+rh baadbbccaabd
+rh baadbbccaabd
+rh baadbbccbab
+rh baadbbccbab
+rh baadbbccbab
+rh baadbbccbab
+rh baadbbccbab
+rh baadbbccbab
+rh baadbbccbab
+rh baadbbccbcabd
+rh baadbbccbcabd
+rh baadbbccbcabd
+rh baadbbcccaa
+rh baadbbcccaa
+rh baadbbcccacaa
+rh baadbbccdbaab
+rh baadbbccdbaab
+rh baadbbccdbaab
+rh baadbbccdbcdd
+rh baadbbcdaadc
+rh baadbbcdaadc
+rh baadbbcdacdb
+rh baadbbcdacdb
+rh baadbbcdacdb
+rh baadbbcdbbb
+rh baadbbcdbbb
+rh baadbbcdbbb
+rh baadbbcdbdd
+rh baadbbcdbdd
+rh baadbbcdbdd
+rh baadbbcddbc
+rh baadbbcddcbab
+rh baadbbdaabaaa
+rh baadbbdaabaaa
+rh baadbbdababcc
+rh baadbbdababcc
+rh baadbbdababcc
+rh baadbbdabacca
+rh baadbbdabdbbd
+rh baadbbdabdbbd
+rh baadbbdabdbbd
+rh baadbbdaccdaa
+rh baadbbdaccdaa
+rh baadbbdadbdb
+rh baadbbdbabb
+rh baadbbdbabb
+rh baadbbdbabb
+rh baadbbdbabdb
+rh baadbbdbabdb
+rh baadbbdbabdb
+rh baadbbdbadcc
+rh baadbbdbadcc
+rh baadbbdbbbb
+rh baadbbdbbbb
+rh baadbbdbcaab
+rh baadbbdbcaab
+rh baadbbdbcaab
+rh baadbbdbcaab
+rh baadbbdbccab
+rh baadbbdbccab
+rh baadbbdbccab
+rh baadbbdbdbb
+rh baadbbdcaaac
+rh baadbbdcaaac
+rh baadbbdcbcd
+rh baadbbdcbcd
+rh baadbbdcbcd
+rh baadbbdcccc
+rh baadbbdcccc
+rh baadbbdccdcb
+rh baadbbdccdcb
+rh baadbbdcdaccb
+rh baadbbdcddb
+rh baadbbdcddcb
+rh baadbbddacdb
+rh baadbbddacdb
+rh baadbbddacdb
+rh baadbbddacdb
+rh baadbbddcbbdd
+rh baadbbddcbbdd
+rh baadbbddcbbdd
+rh baadbbdddbc
+rh baadbbdddbc
+rh baadbcaaaccca
+rh baadbcaaaccca
+rh baadbcaaaccca
+rh baadbcaabcd
+rh baadbcaabcd
+rh baadbcaabcd
+rh baadbcaabda
+rh baadbcaabda
+rh baadbcaacad
+rh baadbcaaccd
+rh baadbcaaccd
+rh baadbcaacdbc
+rh baadbcaacdbc
+rh baadbcaacdc
+rh baadbcaacdc
+rh baadbcaacdc
+rh baadbcaadaa
+rh baadbcaadaa
+rh baadbcaadcdad
+rh baadbcababdbc
+rh baadbcabacdb
+rh baadbcabacdb
+rh baadbcabacdb
+rh baadbcabbadbd
+rh baadbcabbccc
+rh baadbcabbccc
+rh baadbcabdbbc
+rh baadbcabdcbb
+rh baadbcabdcbb
+rh baadbcabddcad
+rh baadbcabddcad
+rh baadbcabddcad
+rh baadbcabddcad
+rh baadbcabddcad
+rh baadbcabddcad
+rh baadbcabddcad
+rh baadbcabdddb
+rh baadbcabdddb
+rh baadbcacabc
+rh baadbcacabc
+rh baadbcacabc
+rh baadbcacbaadb
+rh baadbcacbaadb
+rh baadbcacbaadb
+rh baadbcacddc
+rh baadbcacddc
+rh baadbcadbaaa
+rh baadbcadbaaa
+rh baadbcadbaaa
+rh baadbcadbaaa
+rh baadbcadbaaa
+rh baadbcadcdbba
+rh baadbcaddbbb
+rh baadbcaddbcab
+rh baadbcaddbcab
+rh baadbcbaaaacd
+rh baadbcbaaaacd
+rh baadbcbabadbd
+rh baadbcbacbc
+rh baadbcbacbcb
+rh baadbcbacbcb
+rh baadbcbadacdc
+rh baadbcbadacdc
+rh baadbcbadbd
+rh baadbcbadcdbc
+rh baadbcbadcdbc
+rh baadbcbbbaab
+rh baadbcbbbaab
+rh baadbcbbbaab
+rh baadbcbbcbab
+rh baadbcbbcbab
+rh baadbcbbcdab
+rh baadbcbbcdab
+rh baadbcbbcdab
+rh baadbcbbcdab
+rh baadbcbbdbbd
+rh baadbcbbdbdbb
+rh baadbcbcacb
+rh baadbcbcacb
+rh baadbcbcacb
+rh baadbcbcacb
+rh baadbcbcacb
+rh baadbcbcbadd
+rh baadbcbcdca
+rh baadbcbdbbabd
+rh baadbcbdbbabd
+rh baadbcbdbca
+rh baadbcbdbca
+rh baadbcbdbca
+rh baadbcbdbca
+rh baadbcbdbca
+rh baadbcbdbcdd
+rh baadbcbdbcdd
+rh baadbcbdbcdd
+rh baadbcbdbcdd
+rh baadbcbdbdc
+rh baadbcbdbdc
+rh baadbcbdbdc
+rh baadbcbdbdc
+rh baadbcbdcab
+rh baadbcbdcab
+rh baadbcbdcab
+rh baadbcbdccadd
+rh baadbcbdddbca
+rh baadbcbdddbca
+rh baadbcbdddbca
+rh baadbcbdddbca
+rh baadbccaaab
+rh baadbccaaab
+rh baadbccaaab
+rh baadbccabddb
+rh baadbccabddb
+rh baadbccabddb
+rh baadbccacbbaa
+rh baadbccacbbaa
+rh baadbccacbbaa
+rh baadbccaccdad
+rh baadbccaccdad
+rh baadbccadadb
+rh baadbccadadb
+rh baadbccbacc
+rh baadbccbacc
+rh baadbccbacc
+rh baadbccbbcadc
+rh baadbccbbcadc
+rh baadbccbbcadc
+rh baadbccbcab
+rh baadbccbcab
+rh baadbccbcab
+rh baadbccbcab
+rh baadbccbcab
+rh baadbccbcbcb
+rh baadbccbcbcb
+rh baadbcccadaa
+rh baadbcccadaa
+rh baadbcccbdc
+rh baadbcccbdc
+rh baadbcccbdc
+rh baadbccccca
+rh baadbccccca
+rh baadbcccccd
+rh baadbcccccd
+rh baadbcccdaabc
+rh baadbcccdaabc
+rh baadbccdbbad
+rh baadbccdbbdab
+rh baadbccdbcbab
+rh baadbccdbcbab
+rh baadbccdbcbab
+rh baadbccdbcbab
+rh baadbccdbcbab
+rh baadbccdbcbab
+rh baadbccdbcbab
+rh baadbccdcaba
+rh baadbccdccdda
+rh baadbccdccdda
+rh baadbccdccdda
+rh baadbcdaabbca
+rh baadbcdaabbca
+rh baadbcdaabca
+rh baadbcdaabca
+rh baadbcdaabca
+rh baadbcdaadbc
+rh baadbcdaadd
+rh baadbcdabdbbc
+rh baadbcdabdbbc
+rh baadbcdacacad
+rh baadbcdacacad
+rh baadbcdaccac
+rh baadbcdaccac
+rh baadbcdaddaa
+rh baadbcdaddaa
+rh baadbcdbaacc
+rh baadbcdbaacc
+rh baadbcdbaacc
+rh baadbcdbaacc
+rh baadbcdbaacc
+rh baadbcdbadda
+rh baadbcdbadda
+rh baadbcdbadda
+rh baadbcdbbabcb
+rh baadbcdbbabcb
+rh baadbcdbbabcb
+rh baadbcdbbabcb
+rh baadbcdbbbca
+rh baadbcdbbbd
+rh baadbcdbbbd
+rh baadbcdbcac
+rh baadbcdbcac
+rh baadbcdbddcdb
+rh baadbcdcaaadc
+rh baadbcdcaacc
+rh baadbcdcaacc
+rh baadbcdcaacc
+rh baadbcdcadbd
+rh baadbcdcadbd
+rh baadbcdcadbd
+rh baadbcdcbbd
+rh baadbcdcbbd
+rh baadbcdcbddba
+rh baadbcdcbddba
+rh baadbcdcccacc
+rh baadbcdcccacc
+rh baadbcdcdbdbd
+rh baadbcdcdbdbd
+rh baadbcdcddac
+rh baadbcdcddac
+rh baadbcdcddac
+rh baadbcdcddac
+rh baadbcddaabbd
+rh baadbcddaabbd
+rh baadbcddaadbb
+rh baadbcddaadbb
+rh baadbcddaadbb
+rh baadbcddaadbb
+rh baadbcddbbab
+rh baadbcddbbab
+rh baadbcddbdca
+rh baadbcdddaab
+rh baadbcdddaab
+rh baadbcdddaab
+rh baadbdaaabbb
+rh baadbdaaabbb
+rh baadbdaaabbb
+rh baadbdaabdc
+rh baadbdaabdc
+rh baadbdaacbdac
+rh baadbdaacbdac
+rh baadbdaacbdac
+rh baadbdaaccca
+rh baadbdaaccca
+rh baadbdaaccca
+rh baadbdabaad
+rh baadbdabaad
+rh baadbdabbcbca
+rh baadbdabcbbcd
+rh baadbdabcbcd
+rh baadbdabcbcd
+rh baadbdabcdc
+rh baadbdabcdc
+rh baadbdabcdc
+rh baadbdabdac
+rh baadbdabdac
+rh baadbdabdaccb
+rh baadbdabdaccb
+rh baadbdabdaccb
+rh baadbdabdaccb
+rh baadbdabdaccb
+rh baadbdacaabca
+rh baadbdacaabca
+rh baadbdacaabca
+rh baadbdacabbba
+rh baadbdacabbba
+rh baadbdacabbba
+rh baadbdacadccc
+rh baadbdacbad
+rh baadbdacbad
+rh baadbdacbbd
+rh baadbdacbcccc
+rh baadbdacbcccc
+rh baadbdacbcccc
+rh baadbdacdabbd
+rh baadbdacdabbd
+rh baadbdadacdba
+rh baadbdadcaca
+rh baadbdadcaca
+rh baadbdadcaca
+rh baadbdadcbaa
+rh baadbdadcbaa
+rh baadbdadcbb
+rh baadbdadcbb
+rh baadbdaddacd
+rh baadbdadddb
+rh baadbdadddb
+rh baadbdadddcb
+rh baadbdadddcb
+rh baadbdbabbc
+rh baadbdbabbc
+rh baadbdbabbc
+rh baadbdbacbca
+rh baadbdbacbca
+rh baadbdbacdadb
+rh baadbdbacdadb
+rh baadbdbacdb
+rh baadbdbadcbdc
+rh baadbdbadcbdc
+rh baadbdbbaaddb
+rh baadbdbbaaddb
+rh baadbdbbabbdc
+rh baadbdbbabbdc
+rh baadbdbbada
+rh baadbdbbada
+rh baadbdbbada
+rh baadbdbbada
+rh baadbdbbadcc
+rh baadbdbbadcc
+rh baadbdbbadcc
+rh baadbdbbadcc
+rh baadbdbbadcc
+rh baadbdbbbad
+rh baadbdbbbad
+rh baadbdbbbdac
+rh baadbdbbcacaa
+rh baadbdbbcacaa
+rh baadbdbbcacaa
+rh baadbdbbcacaa
+rh baadbdbbcbcd
+rh baadbdbbdddda
+rh baadbdbcabad
+rh baadbdbcabb
+rh baadbdbcabb
+rh baadbdbcabb
+rh baadbdbcadbda
+rh baadbdbcbaac
+rh baadbdbcbcd
+rh baadbdbcbcd
+rh baadbdbcbcdda
+rh baadbdbcbcdda
+rh baadbdbcbcdda
+rh baadbdbcbda
+rh baadbdbcbdbdd
+rh baadbdbcbdbdd
+rh baadbdbcccb
+rh baadbdbcccb
+rh baadbdbcccb
+rh baadbdbcdac
+rh baadbdbdbcdd
+rh baadbdbdbda
+rh baadbdbdbda
+rh baadbdbdbda
+rh baadbdbdbdaa
+rh baadbdbddabcd
+rh baadbdbddabcd
+rh baadbdcaacbda
+rh baadbdcacaac
+rh baadbdcacbbca
+rh baadbdcacbbca
+rh baadbdcacbbca
+rh baadbdcacbbca
+rh baadbdcacbbca
+rh baadbdcaccad
+rh baadbdcaccad
+rh baadbdcaccad
+rh baadbdcaccad
+rh baadbdcadbad
+rh baadbdcadbad
+rh baadbdcadbad
+rh baadbdcadbad
+rh baadbdcadcaa
+rh baadbdcadcaa
+rh baadbdcadcaa
+rh baadbdcadcaa
+rh baadbdcadddc
+rh baadbdcadddd
+rh baadbdcadddd
+rh baadbdcadddd
+rh baadbdcbaaaa
+rh baadbdcbaaaa
+rh baadbdcbaada
+rh baadbdcbaada
+rh baadbdcbaada
+rh baadbdcbacd
+rh baadbdcbbaaaa
+rh baadbdcbbabaa
+rh baadbdcbbabaa
+rh baadbdcbccaac
+rh baadbdcbccaac
+rh baadbdcbcdcad
+rh baadbdcbcdcad
+rh baadbdcbdadbd
+rh baadbdcbdadbd
+rh baadbdccaab
+rh baadbdccaabb
+rh baadbdccaabb
+rh baadbdccaabb
+rh baadbdccaabb
+rh baadbdccabdaa
+rh baadbdccabdaa
+rh baadbdccbaa
+rh baadbdccbaa
+rh baadbdccbaa
+rh baadbdccbbb
+rh baadbdccbbb
+rh baadbdccbbb
+rh baadbdccbcaba
+rh baadbdccbcaba
+rh baadbdccbcaba
+rh baadbdccbdbdc
+rh baadbdccbdbdc
+rh baadbdcccabcc
+rh baadbdcccabcc
+rh baadbdcccabcd
+rh baadbdccccc
+rh baadbdccdad
+rh baadbdccdad
+rh baadbdccdcba
+rh baadbdccdcba
+rh baadbdccdcba
+rh baadbdcdabcb
+rh baadbdcdbbda
+rh baadbdcdbbda
+rh baadbdcdbbda
+rh baadbdcdbcbb
+rh baadbdcdbdb
+rh baadbdcdbdb
+rh baadbdcdbdb
+rh baadbdcdcccd
+rh baadbdcdcdbd
+rh baadbdcdcdbd
+rh baadbdcdcdbd
+rh baadbdcdcdbd
+rh baadbdcddbbcd
+rh baadbdcddcca
+rh baadbdcddcca
+rh baadbdcddcca
+rh baadbdcdddba
+rh baadbdcdddba
+rh baadbddaaba
+rh baadbddaaba
+rh baadbddaaba
+rh baadbddaaba
+rh baadbddaaba
+rh baadbddaaba
+rh baadbddaaba
+rh baadbddaabc
+rh baadbddaabc
+rh baadbddabab
+rh baadbddabab
+rh baadbddabab
+rh baadbddabab
+rh baadbddabdb
+rh baadbddaccc
+rh baadbddaccc
+rh baadbddaccc
+rh baadbddadddc
+rh baadbddadddc
+rh baadbddbaaa
+rh baadbddbaaa
+rh baadbddbabbcb
+rh baadbddbabbcb
+rh baadbddbabdcb
+rh baadbddbabdcb
+rh baadbddbabdcb
+rh baadbddbabdcb
+rh baadbddbaccd
+rh baadbddbaccd
+rh baadbddbaccd
+rh baadbddbccac
+rh baadbddbccac
+rh baadbddbccac
+rh baadbddbdbdac
+rh baadbddbdbdac
+rh baadbddcbaa
+rh baadbddcbdac
+rh baadbddcbdac
+rh baadbddcbdac
+rh baadbddcbdac
+rh baadbddcbdac
+rh baadbddcbdac
+rh baadbddccaabc
+rh baadbddccaabc
+rh baadbddccaabc
+rh baadbddccaabc
+rh baadbddcccbbc
+rh baadbddcccbbc
+rh baadbddcddadd
+rh baadbddcdddcd
+rh baadbddcdddcd
+rh baadbdddcba
+rh baadbdddcba
+rh baadbdddcba
+rh baadbdddcba
+rh baadbdddcba
+rh baadbdddcba
+rh baadbdddcbacd
+rh baadbdddddbd
+rh baadbdddddbd
+rh baadbdddddbd
+size
+free
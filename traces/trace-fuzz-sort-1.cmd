@@ -0,0 +1,2004 @@
+# Worst case 1 for sort found by 'fuzz sort 200 1000': 8.73 comparisons/element
+# 1000 strings of 2-15 letters a-d after a prefix of 0, 100.0% distinct, descending runs of 582, 98% swapped, seed 0xee45c7b8f75b0d9c
+option fail 0
+option malloc 0
+option bench 1
+option sortalgo merge
+new
+it ddddbcaa
+it ddabbacbabb
+it cbacdddcb
+it adbcaaab
+it acbdb
+it ccdbdacdab
+it dddbb
+it bdbdbbc
+it babca
+it cccabcccbddd
+it acddbc
+it dddaadbabbc
+it bacbcdacbcdbcc
+it bddbaca
+it ab
+it dabcbbdaddd
+it cddaabadadbdaa
+it ccdaaaaab
+it babaabcdccaacab
+it ddbbcbadbaabb
+it cacaddddadbcac
+it dcacb
+it dcbbaaacacba
+it dadbcaacadc
+it ddcbbaaddca
+it ccdad
+it acc
+it bc
+it dddcbacaccddcca
+it bbdadbbcbabadba
+it bdcbcccbc
+it adc
+it babbabbbbdabba
+it bacbdbacad
+it acc
+it db
+it cdbdbbbba
+it dadaaa
+it bad
+it acbbadc
+it ddaabcbada
+it caccdcdbbbdcd
+it bcaa
+it abdbdaadcdc
+it cacbdbddcbaabad
+it cbbacbbdcc
+it dcbbdcdcbdc
+it bbdadbdbaaaba
+it ccbacacbccadc
+it aaabadcbbcc
+it bb
+it dddc
+it acbabaaddcaabbb
+it dccaaaabdcaad
+it ddbbccbabaabb
+it bdbcabdaca
+it cdaaabbdbccc
+it dcdcdcdc
+it aba
+it bdcdabcaaabbc
+it bbcaadbdc
+it dabcdba
+it dcaddbcadbcabba
+it bbadcbccdca
+it ddbdadc
+it aadbbcbbaacbdaa
+it dabaad
+it dcaa
+it dc
+it bdbddbcbcbabbbb
+it caccdbabad
+it cbdbdadcabdcd
+it bcca
+it adbdccbabc
+it dcabbabcbbaaa
+it bddacccaac
+it bbcbbabaa
+it dccddcbcdd
+it bcdddbcdadbc
+it dbd
+it cabac
+it bdcacdcbbdaab
+it bc
+it cadcac
+it dbdcbccadbbdbac
+it aaabadcbbcc
+it caacdcdd
+it dbbdaab 2
+it bcccbacd
+it ad
+it cbcdcdddc
+it dbbbacbda
+it db
+it ddabcaacc
+it adc
+it bbcbbabaa
+it abadaac
+it daad
+it dca
+it bbacaacadbbacd
+it cbcaccbcadcda
+it accdbbdbbcbdada
+it aadbbcbbaacbdaa
+it bbcdcab
+it daaac
+it dba
+it cdacddbdcabcdda
+it bbbdddaacb
+it dabbdcda
+it cdcbddcdbdadd
+it babcccd
+it adc
+it ddbdadc
+it cabcbaababcaac
+it cadb
+it caa
+it adabbbcbbbc
+it dadabdcadbdbcb
+it aadacbbda
+it dcdbabcccabd
+it bbbabddababdddd
+it babcccd
+it bad
+it abcddb
+it dbdcabdcbd
+it bdc
+it acbbadcaa
+it dad
+it ddbbdadaabdaab
+it dcdca
+it acaaaadabcadacc
+it cbdcadd
+it dcabaddb
+it daabccdbaa
+it acddcbbdddbddbb
+it bdbaabbaa
+it aaabbc
+it caadb
+it dacb
+it bcadaadaaddcbd
+it dacabbacbab
+it bddbdd
+it cdcccbbcdaa
+it bbdac
+it bdacaddccd
+it abbbdbbca
+it ccbdbaddbab
+it adacaaddb
+it dbabcba
+it cacaacdcbdcab
+it cbcbcddccd
+it dbb
+it daacaabadc
+it cbcbcddccd
+it ddccccbacacbbd
+it cddda
+it dacbbbcddbbabca
+it ccb
+it abccababbaa
+it cddda
+it bbcbcd
+it bbddabb
+it cdbdbbbba
+it da
+it dcbadcacbdda
+it cddacadbc
+it abcdaddadacdad
+it ccdc
+it ddaddbd
+it cdcddccccbd
+it bccbb
+it cbbdbcba
+it dadccab
+it dcaccdd
+it bc
+it bb
+it cdbccada
+it ddcdbdabd
+it cdacddbdcabcdda
+it dccaad
+it cdbaadaabcbabd
+it bdcbcccbc
+it cdcddd
+it cdadddddcbada
+it ccbaaaabc
+it dcabbabcbbaaa
+it daccddadcbdadc
+it ddabcaacc
+it ccaabcd
+it cdda
+it dca
+it cddcddbabca
+it bdcdbcad
+it cababcc
+it bad
+it daabccdbaa
+it dbdcabdcbd
+it cbba
+it babdbddca
+it dddadbabbc
+it ccbacacbccadc
+it cacdddabbbccacd
+it abbddadbbddbcad
+it abcaaddbcdaddc
+it ccd
+it cccdc
+it addaabc
+it baaabc
+it dccccbacccaa
+it dbabc
+it bbdadbbcbabadba
+it cbc
+it ccbbdbacddbabdb 2
+it dbbdadcdaccca
+it acabbccb
+it aabbaacdcdbdaaa
+it ba
+it bb
+it cdddcbdcabbc
+it ccbdaabcccddcbc
+it dadbaca
+it abbbcd
+it aacacbabd
+it cabdb
+it cbbdbdbadd
+it bdddacccdcddd
+it cc
+it dacdaccdab
+it ccdaabaa
+it cbdcaadddadddad
+it bddcacbcdd
+it adbdccbabc
+it adcbdbc
+it cacccaabd
+it ddbba
+it cbbdcbcbacdda
+it cbcccbda
+it ddbdadc
+it bdacaddccd
+it bcdbbbbcbbadd
+it cbabb
+it cbcaccbcadcda
+it dddaaaabdcdbacc
+it baadbbbdccbbabd
+it caacbccbbcd
+it ccaaadadda
+it bbdac
+it cddacadbc
+it ccbcccadbbb
+it dccadbdbac
+it cbdcadd
+it baacaba
+it aadaadadcaddc
+it abaabad
+it cbadbbdbb
+it cbadbbacbcaca
+it dbbadadadcadd
+it cabbab
+it aac
+it adcb
+it cbaaba
+it aadb
+it ccdc
+it ccdbdacdab
+it caddddabddcdb
+it babcccd
+it daacd
+it dbd
+it cdaaabbdbccc
+it ddcdddddcdcd
+it bacac
+it cadb 2
+it bacdbbdcabdaac
+it ddbadaadaaba
+it cacdd
+it cbba
+it bdadccddbbadcbd
+it bddbaca
+it ddaddbd
+it cbacbccadccac
+it cacccaabd
+it ac
+it bacdcdbababccdd
+it acdddbbccc
+it ddabcaacc
+it bacbcdacbcdbcc
+it acadabac
+it dbbadadadcadd
+it dabd
+it baacaba
+it bb
+it cbcbbadaa
+it bccddb
+it ccbacdcd
+it bbdbd
+it cbcaccbcadcda
+it caadacc
+it dbbca
+it bdaba
+it cbcaddbd
+it dadbbaabc
+it aac
+it babaabcdccaacab
+it accdbbdbbcbdada
+it dabab
+it bdbaabbaa
+it cbcadbccd
+it dadbbaabc
+it ba
+it ca
+it ddd
+it dbbbacbda
+it acadabac
+it abaccbdadddba
+it abcdbbc
+it ddcdcdbac
+it babddda
+it adcdacdacdddda
+it bcca
+it ddcadddbbba
+it dbdacda
+it dadb
+it baa
+it ddddba
+it ddaaba
+it dcbbdcdcbdc
+it adc
+it addabdbdccadcb
+it cbadbbdbb
+it bbc
+it bbcdbcbabba
+it cacdddabbbccacd
+it bdbcabdaca
+it cadb
+it aabbaacdcdbdaaa
+it bdadccddbbadcbd
+it cababcc
+it addabadadcaac
+it caadaadaddddb
+it cacccbccb
+it bda
+it bd
+it dbdada
+it cdbacbaaac
+it bacdabcd
+it aacbbdbdd
+it ccacbcbcac
+it bcc
+it ddbaad
+it ddcdbdabd
+it bbacaacadbbacd
+it bcccbbd
+it dbcbdbdcdaadc
+it ddbbcacc
+it cbddad
+it bdcdbcad
+it bacdcdbababccdd
+it cadb
+it abdcccd
+it bcbda
+it bcbd
+it acbadadbccc
+it cbccdadaacbdd
+it bbcda
+it bcadcdcad
+it ccdaabaa
+it bddacccaac
+it bcdb
+it bbcaa
+it bbdba
+it bca
+it dbbbb
+it ddabbacbabb
+it acbdb
+it bc
+it caccdbabad
+it adcdacdacdddda
+it bbddabb
+it bbdcbbddcdacb
+it bc
+it aadcddbdcbaba
+it dbddbd
+it bcddbbcacddc
+it acabbdbdcbdb
+it cbba
+it cddcddbabca
+it abaaddb
+it cbbdcbcbacdda
+it acabdaacc
+it aacbcbc
+it dabd
+it adbadbbc
+it bbcaa 2
+it bcacdabdababba
+it ad
+it caddddbcb
+it aabba
+it abb
+it adccaabaa
+it cabdbbaaacbda
+it abcdaddadacdad
+it bbdcbbddcdacb
+it bbadaa
+it bcccccaddbbb
+it aacdab
+it bcacbcbbcadabb
+it dddcbaacdcba
+it dbaccbabbccdd
+it bb 2
+it cabcddccc
+it ccaaadadda
+it baddbc
+it bacbdbacad
+it badabdaa
+it dbccbdccdab
+it acdcddcc
+it adcadcaddd
+it ccaaadadda
+it cbadba
+it ddadbaccddda
+it caddbbbccaba
+it ac
+it bacac
+it bcddccaa
+it acdacdbbdda
+it caadacc
+it ccadadc
+it ddbcdacdcadadc
+it baccdb
+it dbbaaac
+it cabcccdb
+it ddaaadcabaacacd
+it dbdada
+it dbdccbdadbddbd
+it ddd
+it ab
+it cdaadbdbabcabc
+it dabdaadcdbbcbbc
+it abcda
+it bcdcbcccdabbcc
+it dbbb
+it ddbbbca
+it addccdd
+it ddacdaddbacb
+it addabdbdccadcb
+it bcacdcbbbccb
+it bcbcdacbabcb
+it bbaa
+it adadaccaaabca
+it cacbaba
+it adcadcaddd
+it abbbcd
+it badddddc
+it cabcddccc
+it dbbcdaacc
+it adcc
+it cacacabacd
+it cbc
+it bbccabbccbcb
+it abaacdbabadbd
+it abaabad
+it abcacdabd
+it dddadbabbc
+it abbabcddaaccac
+it baaccbacdcd
+it bbcadcccc
+it cdcabcbdd
+it aacddadaaaccbd
+it adbadbbc
+it bbcacaaad
+it bcacdcbbbccb
+it adadaa
+it dbaaddddd
+it aaaaacc
+it bddacccaac
+it bbcaa
+it ddcbddaacdad
+it bdd
+it ccabdd
+it ad
+it ddbaad
+it acddbc
+it ddccccbacacbbd
+it dabbdcda
+it bbcbbabaa
+it dac
+it abcacdabd
+it badaacac
+it cad
+it dbdc
+it bbdbb
+it ddaca
+it ccb
+it adabd
+it dcdcdcab
+it ddaba
+it acbccbbada
+it aaac
+it acbbba
+it ddabbcc
+it bbbddbbccccd
+it ddabbcc
+it dbbdbdbdccacabc
+it cdbaaacdbda
+it accdbbdbbcbdada
+it dadadbaadcacd
+it dadadd
+it cbddad
+it ccdc
+it bdaacbaabbcd
+it dbcabbcbcaba
+it bccbb
+it bbdbaadadbdbdbd
+it bbdadadda
+it bcadaadaaddcbd
+it cacccaabd
+it aabba
+it ab
+it dddadcaccd
+it baccdb
+it caabbdd
+it dcbcddbdab
+it cbddad
+it aabd
+it ccc
+it daacd
+it cddacdab
+it abbddadbbddbcad
+it ba
+it acabccd
+it bad
+it abbbd
+it cdcccbbcdaa
+it dcaa
+it cd
+it adbcaaab
+it da
+it abadaac
+it bbbad
+it cc
+it abcbcdbabddcbbb
+it bcc
+it aabaacbabaaad
+it dabd
+it ddcd
+it dacdcbbbdd
+it cbbaccdbddc
+it ccbaccaa
+it ccdbddd
+it abbabcddaaccac
+it aadacabdccd
+it aadaadadcaddc
+it ccdc
+it bacdcdbababccdd
+it dcbdcddcba
+it aacdbccb
+it aacdab
+it dcaa
+it cbbdaccdbbdbbdb
+it aadbbaaddba
+it aac
+it cac
+it ddbbdbcaaaccbd
+it dbccabdbbbdbdcd
+it cdadddddcbada
+it aacdcabb
+it dbadcc
+it ababca
+it aabaacbabaaad
+it cdaadbdbabcabc
+it abcaabbcacbaac
+it aaadcccbbc
+it bccccddddbd
+it acbbcddca
+it dacbcdcbb
+it cbcaccbcadcda
+it daacbacddabada
+it bdacccdcbacca
+it cdadddddcbada
+it bd
+it acdccaadb
+it cacacdcddcabba
+it cadbaddaad
+it aaadcccbbc
+it cdbcbbdaab
+it ddcdbdabd
+it ccdbbabad
+it daddbcab
+it dcacb
+it bbbabdba
+it ddbdc
+it caadacc
+it dcabdacbac
+it dcbdcddcba
+it badcdcbcababac
+it daab
+it ddbbaaca
+it cbccdadaacbdd
+it baccacbcbcdcddd
+it cc
+it daccdc
+it addda
+it dacccacdacbbad
+it ddabbadaadcdadd
+it babbcbbcacdacca
+it ddabbacbabb
+it dddadbabbc
+it abbbd
+it bdddccba
+it ab
+it aabd
+it adbbddbddbb
+it cbbdaccdbbdbbdb
+it dadaa
+it cddddddcaa
+it adcccdc
+it abcbcadbdcabada
+it dccbbbdd
+it cdadddddcbada
+it cadbabaa
+it cbcbdbbcbd
+it dcbcddbdab
+it cbbdbcba
+it cacdababcad
+it aaba
+it bacbdbacad
+it dcacb
+it ccabc
+it dcabdabd
+it bcadaaabbdddac
+it dabdaadcdbbcbbc
+it bbdca
+it acadcab
+it bcbbccdd
+it dca
+it dadcbccabdaca
+it dbbcdaacc
+it bdcdbb
+it addabdbdccadcb
+it cadcdaddd
+it ddcbaddabdabc
+it aa
+it dacb
+it dbccabdbbbdbdcd
+it dcabbabcbbaaa
+it daacbacddabada
+it dbbdbdbdccacabc
+it adabbbcbbbc
+it bbcbd
+it daadcacbdcdaac
+it bcacbbbccbaac
+it daccddab
+it abaaddb
+it cbaabbacbaccabd
+it dacdcbbc
+it aabba
+it bbbbb
+it cadcadbaada
+it daaac
+it db
+it aadbbcbbaacbdaa
+it db
+it ccdad
+it dadbbaabc
+it bdccacccbb
+it ad
+it dbcddbc
+it bbacaacadbbacd
+it bacbcdacbcdbcc
+it dadaa
+it cdbbdbbabbcb
+it adcccdccdccbb
+it daccddab
+it ddcdbdabd
+it dadbaca
+it bcbdbcacb
+it dacb
+it addda
+it acacccbaacaadd
+it aabba
+it caccdcdbbbdcd
+it dacccacdacbbad
+it adaaccbd
+it aba
+it dadbaca
+it ccbdcabbabc
+it bca
+it dcaddbcadbcabba
+it aaabaacca
+it cdda
+it dbcbdbdcdaadc
+it db
+it ccdcdbcc
+it ccabdd
+it dcbdcaacdbbbcba
+it cac
+it cdadaababca
+it ad
+it acadbdaaa
+it cb
+it abbbcd
+it dadb
+it aaba
+it cac
+it ccdad
+it cdbbdbbabbcb
+it dab
+it dacccd
+it ddccdacdaddbb
+it cbcbbadaa
+it ddacdaddbacb
+it aca
+it dcdca
+it bdccacccbb
+it abddb
+it abaaddb
+it cccdccdd 2
+it babdbddca
+it cccbd
+it cccbbacaadbccc
+it cacccadcbcdabac
+it ddcdcdbac
+it ccbdaabcccddcbc
+it dabab
+it babbabbbbdabba
+it daddabdbacbbbad
+it dcdbabcccabd
+it dadadd
+it cbaaba
+it dadaa
+it bacbdcb
+it adbcccdabcda
+it cdcbddcdbdadd
+it cdddcbdcabbc
+it ddddbcaa
+it babcb
+it daadcacbdcdaac
+it dadc
+it aabcccaaacdcb
+it dcbdbccdbcaba
+it dbbca
+it bbd
+it dbaccdbacbccddd
+it cbcbadcdddcdb
+it cbbdbdbadd
+it ccdaaaaab
+it adaacdadb
+it cabcccdb
+it acabbccb
+it bcbbccdd
+it adcdb
+it abbabcddaaccac
+it aadadbdad
+it cbdbdbdaaccccba
+it bdacdddbdbd
+it cacccadcbcdabac
+it cbacdddcb
+it babdbcbbc
+it bdbaabbaa
+it ca
+it cbaaba
+it adcbdbc
+it cdbacbddbdcc
+it ad
+it acabc
+it cadcdaddd
+it dcabdaddbdcdc
+it dad
+it ca
+it caaadbddbacbdc
+it aabdcd
+it daccddab
+it cad
+it abcdbbc
+it cacdababcad
+it dcaccdd
+it ba
+it caaadbddbacbdc
+it caccdbabad
+it cacccbccb
+it cbbdbdbadd
+it bbadaa
+it dddcaa
+it caccaabacd
+it dc
+it adccabadbada
+it dccdaddbcd
+it bdd
+it cddbbcbbda
+it cbacbccadccac
+it badbbbcbaacada
+it caacdcdd
+it cbccdadaacbdd
+it bcbbaabcccbaadc
+it bdbcbddada
+it ca
+it abcacdabd
+it acbdd
+it bbccabbccbcb
+it bdbddba
+it bbbdaaabdbdbca
+it cccbbcdbaac
+it dbbadadadcadd
+it cdb
+it abcdbcdadabdbd
+it ccabc
+it dcdbabcccabd
+it adcadc
+it bddddccadaababa
+it cacadcdcdb
+it acdbaaabbbc
+it ddbdadd
+it caddbbbccaba
+it badddddc
+it daacbdaacbbadb
+it bbc
+it bbbdaaabdbdbca
+it ddcadddbbba
+it cacbaba
+it bddbdd
+it dcacb
+it cad
+it ddcadddbbba
+it dacdcbbbdd
+it bdbaabbaa
+it dcdbddcaddaacdd
+it addaabc
+it dbaaddddd
+it abdcbadaabcaabb
+it abdcadc
+it bbdadbdbaaaba
+it cdcccbbcdaa
+it bccccddddbd
+it ccdbbdd
+it cadcdaddd
+it cbacdddcb
+it acbdb
+it da
+it acdcddcc
+it cabdbcccd
+it dadbbcdb
+it acddbbdda
+it bcab
+it ddaabcbada
+it bca
+it cabbabbbcbacbb
+it caccdbabad
+it cdadddddcbada
+it dcaa
+it accabbbddcbbbd
+it bdbaabbaa
+it bca
+it bcbcdacbabcb
+it cabbabbbcbacbb
+it bbbc
+it bbaadcdcad
+it addcdca
+it adddbda
+it dcccdacbacdaaca
+it bdcbddd
+it caacb
+it bcb
+it adbbddbddbb
+it dcbdcddbadac
+it cbaaba
+it dcddbdda
+it aabdcb
+it accbdaabddba
+it cb
+it bbbc
+it bbbbb
+it aca
+it acdddbbccc
+it ddcdddddcdcd
+it bcc
+it dbbbacbda
+it bdc
+it adcadc
+it da
+it ccccaacd
+it dbd
+it bdddccba
+it caaadbddbacbdc
+it ccbaccaa
+it cddcbaddbaaacdc
+it caacb
+it cdcbddcdbdadd
+it bacdabcd
+it cbbdbcba
+it bcdddbcdadbc
+it bacaad
+it cbccdadaacbdd
+it cbcbcc
+it ccdbdacdab
+it cabbccacdcb
+it cadbabaa
+it bac
+it daccdc
+it bdccb
+it adcdb
+it babcaccddbac
+it babbabbbbdabba
+it acdcddcc
+it ccbacbbdddbbd
+it ccbaccaa
+it abbbdbbca
+it baacaba
+it baaadcdad
+it bbbabddababdddd
+it dbbaaac
+it cbadccab
+it ba
+it cacaddcdbd
+it addccdd
+it dbadbbddbbdcd
+it ab
+it bbdaaadaaadbbaa
+it bdcacdcbbdaab
+it bdcbcccbc
+it abaccbdadddba
+it bbaa
+it bc
+it ccccaacd
+it bdaa
+it caacb
+it ca
+it dddadcaccd
+it caadaadaddddb
+it ccbaccaa
+it dacdac
+it adcdbbadadb
+it adaaaab
+it cbbaccdbddc
+it cabcccdb
+it acbbba
+it dccdaddbcd
+it acddabdaaa
+it ccbcdbcbbcbcabc
+it acdcccdbcacccbb
+it accdaccbcddaccb
+it babdddabaddbbdc
+it adcdacdacdddda
+it cadbdaccab
+it acbadcbddb
+it aacdcabb
+it cddbcb
+it aaadacd
+it acabc
+it adcbdbc
+it dcccabcbdccbbda
+it dadaa
+it ddaca
+it dcacb
+it dbd
+it abbcdcddadbccc
+it dadbaca
+it ccdcdbcc
+it aaaddc
+it bcdbbbbcbbadd
+it bacd
+it dccdd
+it cabbdabcbcdcd
+it aadadbc
+it adabd
+it aacdab
+it ddbacacabdbbc
+it dadbbaabc
+it dbaaddddd
+it dbdccbdadbddbd
+it bbdac
+it dabdaadcdbbcbbc
+it dcdcdcab
+it dbaaddddd
+it bdbddca
+it aadbbadcb
+it caaadbddbacbdc
+it dadadd
+it addabadadcaac
+it caaa
+it cbdcccbbb
+it cc
+it dbdcbdbdccaacaa
+it bdbcbddada
+it bbdca
+it db
+it ad
+it dbadcc
+it ddddba
+it abaacabbbda
+it abbbacacddacbcd
+it dbaccbabbccdd
+it bbdacbbacabdbd
+it cdbaadaabcbabd
+it bbdadadda
+sort
+rh aa
+rh aaaaacc
+rh aaabaacca
+rh aaabadcbbcc
+rh aaabadcbbcc
+rh aaabbc
+rh aaac
+rh aaadacd
+rh aaadcccbbc
+rh aaadcccbbc
+rh aaaddc
+rh aaba
+rh aaba
+rh aabaacbabaaad
+rh aabaacbabaaad
+rh aabba
+rh aabba
+rh aabba
+rh aabba
+rh aabbaacdcdbdaaa
+rh aabbaacdcdbdaaa
+rh aabcccaaacdcb
+rh aabd
+rh aabd
+rh aabdcb
+rh aabdcd
+rh aac
+rh aac
+rh aac
+rh aacacbabd
+rh aacbbdbdd
+rh aacbcbc
+rh aacdab
+rh aacdab
+rh aacdab
+rh aacdbccb
+rh aacdcabb
+rh aacdcabb
+rh aacddadaaaccbd
+rh aadaadadcaddc
+rh aadaadadcaddc
+rh aadacabdccd
+rh aadacbbda
+rh aadadbc
+rh aadadbdad
+rh aadb
+rh aadbbaaddba
+rh aadbbadcb
+rh aadbbcbbaacbdaa
+rh aadbbcbbaacbdaa
+rh aadbbcbbaacbdaa
+rh aadcddbdcbaba
+rh ab
+rh ab
+rh ab
+rh ab
+rh ab
+rh aba
+rh aba
+rh abaabad
+rh abaabad
+rh abaacabbbda
+rh abaacdbabadbd
+rh abaaddb
+rh abaaddb
+rh abaaddb
+rh ababca
+rh abaccbdadddba
+rh abaccbdadddba
+rh abadaac
+rh abadaac
+rh abb
+rh abbabcddaaccac
+rh abbabcddaaccac
+rh abbabcddaaccac
+rh abbbacacddacbcd
+rh abbbcd
+rh abbbcd
+rh abbbcd
+rh abbbd
+rh abbbd
+rh abbbdbbca
+rh abbbdbbca
+rh abbcdcddadbccc
+rh abbddadbbddbcad
+rh abbddadbbddbcad
+rh abcaabbcacbaac
+rh abcaaddbcdaddc
+rh abcacdabd
+rh abcacdabd
+rh abcacdabd
+rh abcbcadbdcabada
+rh abcbcdbabddcbbb
+rh abccababbaa
+rh abcda
+rh abcdaddadacdad
+rh abcdaddadacdad
+rh abcdbbc
+rh abcdbbc
+rh abcdbcdadabdbd
+rh abcddb
+rh abdbdaadcdc
+rh abdcadc
+rh abdcbadaabcaabb
+rh abdcccd
+rh abddb
+rh ac
+rh ac
+rh aca
+rh aca
+rh acaaaadabcadacc
+rh acabbccb
+rh acabbccb
+rh acabbdbdcbdb
+rh acabc
+rh acabc
+rh acabccd
+rh acabdaacc
+rh acacccbaacaadd
+rh acadabac
+rh acadabac
+rh acadbdaaa
+rh acadcab
+rh acbabaaddcaabbb
+rh acbadadbccc
+rh acbadcbddb
+rh acbbadc
+rh acbbadcaa
+rh acbbba
+rh acbbba
+rh acbbcddca
+rh acbccbbada
+rh acbdb
+rh acbdb
+rh acbdb
+rh acbdd
+rh acc
+rh acc
+rh accabbbddcbbbd
+rh accbdaabddba
+rh accdaccbcddaccb
+rh accdbbdbbcbdada
+rh accdbbdbbcbdada
+rh accdbbdbbcbdada
+rh acdacdbbdda
+rh acdbaaabbbc
+rh acdccaadb
+rh acdcccdbcacccbb
+rh acdcddcc
+rh acdcddcc
+rh acdcddcc
+rh acddabdaaa
+rh acddbbdda
+rh acddbc
+rh acddbc
+rh acddcbbdddbddbb
+rh acdddbbccc
+rh acdddbbccc
+rh ad
+rh ad
+rh ad
+rh ad
+rh ad
+rh ad
+rh ad
+rh adaaaab
+rh adaaccbd
+rh adaacdadb
+rh adabbbcbbbc
+rh adabbbcbbbc
+rh adabd
+rh adabd
+rh adacaaddb
+rh adadaa
+rh adadaccaaabca
+rh adbadbbc
+rh adbadbbc
+rh adbbddbddbb
+rh adbbddbddbb
+rh adbcaaab
+rh adbcaaab
+rh adbcccdabcda
+rh adbdccbabc
+rh adbdccbabc
+rh adc
+rh adc
+rh adc
+rh adc
+rh adcadc
+rh adcadc
+rh adcadcaddd
+rh adcadcaddd
+rh adcb
+rh adcbdbc
+rh adcbdbc
+rh adcbdbc
+rh adcc
+rh adccaabaa
+rh adccabadbada
+rh adcccdc
+rh adcccdccdccbb
+rh adcdacdacdddda
+rh adcdacdacdddda
+rh adcdacdacdddda
+rh adcdb
+rh adcdb
+rh adcdbbadadb
+rh addaabc
+rh addaabc
+rh addabadadcaac
+rh addabadadcaac
+rh addabdbdccadcb
+rh addabdbdccadcb
+rh addabdbdccadcb
+rh addccdd
+rh addccdd
+rh addcdca
+rh addda
+rh addda
+rh adddbda
+rh ba
+rh ba
+rh ba
+rh ba
+rh ba
+rh baa
+rh baaabc
+rh baaadcdad
+rh baacaba
+rh baacaba
+rh baacaba
+rh baaccbacdcd
+rh baadbbbdccbbabd
+rh babaabcdccaacab
+rh babaabcdccaacab
+rh babbabbbbdabba
+rh babbabbbbdabba
+rh babbabbbbdabba
+rh babbcbbcacdacca
+rh babca
+rh babcaccddbac
+rh babcb
+rh babcccd
+rh babcccd
+rh babcccd
+rh babdbcbbc
+rh babdbddca
+rh babdbddca
+rh babddda
+rh babdddabaddbbdc
+rh bac
+rh bacaad
+rh bacac
+rh bacac
+rh bacbcdacbcdbcc
+rh bacbcdacbcdbcc
+rh bacbcdacbcdbcc
+rh bacbdbacad
+rh bacbdbacad
+rh bacbdbacad
+rh bacbdcb
+rh baccacbcbcdcddd
+rh baccdb
+rh baccdb
+rh bacd
+rh bacdabcd
+rh bacdabcd
+rh bacdbbdcabdaac
+rh bacdcdbababccdd
+rh bacdcdbababccdd
+rh bacdcdbababccdd
+rh bad
+rh bad
+rh bad
+rh bad
+rh badaacac
+rh badabdaa
+rh badbbbcbaacada
+rh badcdcbcababac
+rh baddbc
+rh badddddc
+rh badddddc
+rh bb
+rh bb
+rh bb
+rh bb
+rh bb
+rh bb
+rh bbaa
+rh bbaa
+rh bbaadcdcad
+rh bbacaacadbbacd
+rh bbacaacadbbacd
+rh bbacaacadbbacd
+rh bbadaa
+rh bbadaa
+rh bbadcbccdca
+rh bbbabdba
+rh bbbabddababdddd
+rh bbbabddababdddd
+rh bbbad
+rh bbbbb
+rh bbbbb
+rh bbbc
+rh bbbc
+rh bbbdaaabdbdbca
+rh bbbdaaabdbdbca
+rh bbbddbbccccd
+rh bbbdddaacb
+rh bbc
+rh bbc
+rh bbcaa
+rh bbcaa
+rh bbcaa
+rh bbcaa
+rh bbcaadbdc
+rh bbcacaaad
+rh bbcadcccc
+rh bbcbbabaa
+rh bbcbbabaa
+rh bbcbbabaa
+rh bbcbcd
+rh bbcbd
+rh bbccabbccbcb
+rh bbccabbccbcb
+rh bbcda
+rh bbcdbcbabba
+rh bbcdcab
+rh bbd
+rh bbdaaadaaadbbaa
+rh bbdac
+rh bbdac
+rh bbdac
+rh bbdacbbacabdbd
+rh bbdadadda
+rh bbdadadda
+rh bbdadbbcbabadba
+rh bbdadbbcbabadba
+rh bbdadbdbaaaba
+rh bbdadbdbaaaba
+rh bbdba
+rh bbdbaadadbdbdbd
+rh bbdbb
+rh bbdbd
+rh bbdca
+rh bbdca
+rh bbdcbbddcdacb
+rh bbdcbbddcdacb
+rh bbddabb
+rh bbddabb
+rh bc
+rh bc
+rh bc
+rh bc
+rh bc
+rh bc
+rh bca
+rh bca
+rh bca
+rh bca
+rh bcaa
+rh bcab
+rh bcacbbbccbaac
+rh bcacbcbbcadabb
+rh bcacdabdababba
+rh bcacdcbbbccb
+rh bcacdcbbbccb
+rh bcadaaabbdddac
+rh bcadaadaaddcbd
+rh bcadaadaaddcbd
+rh bcadcdcad
+rh bcb
+rh bcbbaabcccbaadc
+rh bcbbccdd
+rh bcbbccdd
+rh bcbcdacbabcb
+rh bcbcdacbabcb
+rh bcbd
+rh bcbda
+rh bcbdbcacb
+rh bcc
+rh bcc
+rh bcc
+rh bcca
+rh bcca
+rh bccbb
+rh bccbb
+rh bcccbacd
+rh bcccbbd
+rh bcccccaddbbb
+rh bccccddddbd
+rh bccccddddbd
+rh bccddb
+rh bcdb
+rh bcdbbbbcbbadd
+rh bcdbbbbcbbadd
+rh bcdcbcccdabbcc
+rh bcddbbcacddc
+rh bcddccaa
+rh bcdddbcdadbc
+rh bcdddbcdadbc
+rh bd
+rh bd
+rh bda
+rh bdaa
+rh bdaacbaabbcd
+rh bdaba
+rh bdacaddccd
+rh bdacaddccd
+rh bdacccdcbacca
+rh bdacdddbdbd
+rh bdadccddbbadcbd
+rh bdadccddbbadcbd
+rh bdbaabbaa
+rh bdbaabbaa
+rh bdbaabbaa
+rh bdbaabbaa
+rh bdbaabbaa
+rh bdbcabdaca
+rh bdbcabdaca
+rh bdbcbddada
+rh bdbcbddada
+rh bdbdbbc
+rh bdbddba
+rh bdbddbcbcbabbbb
+rh bdbddca
+rh bdc
+rh bdc
+rh bdcacdcbbdaab
+rh bdcacdcbbdaab
+rh bdcbcccbc
+rh bdcbcccbc
+rh bdcbcccbc
+rh bdcbddd
+rh bdccacccbb
+rh bdccacccbb
+rh bdccb
+rh bdcdabcaaabbc
+rh bdcdbb
+rh bdcdbcad
+rh bdcdbcad
+rh bdd
+rh bdd
+rh bddacccaac
+rh bddacccaac
+rh bddacccaac
+rh bddbaca
+rh bddbaca
+rh bddbdd
+rh bddbdd
+rh bddcacbcdd
+rh bdddacccdcddd
+rh bdddccba
+rh bdddccba
+rh bddddccadaababa
+rh ca
+rh ca
+rh ca
+rh ca
+rh ca
+rh caa
+rh caaa
+rh caaadbddbacbdc
+rh caaadbddbacbdc
+rh caaadbddbacbdc
+rh caaadbddbacbdc
+rh caabbdd
+rh caacb
+rh caacb
+rh caacb
+rh caacbccbbcd
+rh caacdcdd
+rh caacdcdd
+rh caadaadaddddb
+rh caadaadaddddb
+rh caadacc
+rh caadacc
+rh caadacc
+rh caadb
+rh cababcc
+rh cababcc
+rh cabac
+rh cabbab
+rh cabbabbbcbacbb
+rh cabbabbbcbacbb
+rh cabbccacdcb
+rh cabbdabcbcdcd
+rh cabcbaababcaac
+rh cabcccdb
+rh cabcccdb
+rh cabcccdb
+rh cabcddccc
+rh cabcddccc
+rh cabdb
+rh cabdbbaaacbda
+rh cabdbcccd
+rh cac
+rh cac
+rh cac
+rh cacaacdcbdcab
+rh cacacabacd
+rh cacacdcddcabba
+rh cacadcdcdb
+rh cacaddcdbd
+rh cacaddddadbcac
+rh cacbaba
+rh cacbaba
+rh cacbdbddcbaabad
+rh caccaabacd
+rh cacccaabd
+rh cacccaabd
+rh cacccaabd
+rh cacccadcbcdabac
+rh cacccadcbcdabac
+rh cacccbccb
+rh cacccbccb
+rh caccdbabad
+rh caccdbabad
+rh caccdbabad
+rh caccdbabad
+rh caccdcdbbbdcd
+rh caccdcdbbbdcd
+rh cacdababcad
+rh cacdababcad
+rh cacdd
+rh cacdddabbbccacd
+rh cacdddabbbccacd
+rh cad
+rh cad
+rh cad
+rh cadb
+rh cadb
+rh cadb
+rh cadb
+rh cadb
+rh cadbabaa
+rh cadbabaa
+rh cadbaddaad
+rh cadbdaccab
+rh cadcac
+rh cadcadbaada
+rh cadcdaddd
+rh cadcdaddd
+rh cadcdaddd
+rh caddbbbccaba
+rh caddbbbccaba
+rh caddddabddcdb
+rh caddddbcb
+rh cb
+rh cb
+rh cbaaba
+rh cbaaba
+rh cbaaba
+rh cbaaba
+rh cbaabbacbaccabd
+rh cbabb
+rh cbacbccadccac
+rh cbacbccadccac
+rh cbacdddcb
+rh cbacdddcb
+rh cbacdddcb
+rh cbadba
+rh cbadbbacbcaca
+rh cbadbbdbb
+rh cbadbbdbb
+rh cbadccab
+rh cbba
+rh cbba
+rh cbba
+rh cbbacbbdcc
+rh cbbaccdbddc
+rh cbbaccdbddc
+rh cbbdaccdbbdbbdb
+rh cbbdaccdbbdbbdb
+rh cbbdbcba
+rh cbbdbcba
+rh cbbdbcba
+rh cbbdbdbadd
+rh cbbdbdbadd
+rh cbbdbdbadd
+rh cbbdcbcbacdda
+rh cbbdcbcbacdda
+rh cbc
+rh cbc
+rh cbcaccbcadcda
+rh cbcaccbcadcda
+rh cbcaccbcadcda
+rh cbcaccbcadcda
+rh cbcadbccd
+rh cbcaddbd
+rh cbcbadcdddcdb
+rh cbcbbadaa
+rh cbcbbadaa
+rh cbcbcc
+rh cbcbcddccd
+rh cbcbcddccd
+rh cbcbdbbcbd
+rh cbcccbda
+rh cbccdadaacbdd
+rh cbccdadaacbdd
+rh cbccdadaacbdd
+rh cbccdadaacbdd
+rh cbcdcdddc
+rh cbdbdadcabdcd
+rh cbdbdbdaaccccba
+rh cbdcaadddadddad
+rh cbdcadd
+rh cbdcadd
+rh cbdcccbbb
+rh cbddad
+rh cbddad
+rh cbddad
+rh cc
+rh cc
+rh cc
+rh cc
+rh ccaaadadda
+rh ccaaadadda
+rh ccaaadadda
+rh ccaabcd
+rh ccabc
+rh ccabc
+rh ccabdd
+rh ccabdd
+rh ccacbcbcac
+rh ccadadc
+rh ccb
+rh ccb
+rh ccbaaaabc
+rh ccbacacbccadc
+rh ccbacacbccadc
+rh ccbacbbdddbbd
+rh ccbaccaa
+rh ccbaccaa
+rh ccbaccaa
+rh ccbaccaa
+rh ccbacdcd
+rh ccbbdbacddbabdb
+rh ccbbdbacddbabdb
+rh ccbcccadbbb
+rh ccbcdbcbbcbcabc
+rh ccbdaabcccddcbc
+rh ccbdaabcccddcbc
+rh ccbdbaddbab
+rh ccbdcabbabc
+rh ccc
+rh cccabcccbddd
+rh cccbbacaadbccc
+rh cccbbcdbaac
+rh cccbd
+rh ccccaacd
+rh ccccaacd
+rh cccdc
+rh cccdccdd
+rh cccdccdd
+rh ccd
+rh ccdaaaaab
+rh ccdaaaaab
+rh ccdaabaa
+rh ccdaabaa
+rh ccdad
+rh ccdad
+rh ccdad
+rh ccdbbabad
+rh ccdbbdd
+rh ccdbdacdab
+rh ccdbdacdab
+rh ccdbdacdab
+rh ccdbddd
+rh ccdc
+rh ccdc
+rh ccdc
+rh ccdc
+rh ccdcdbcc
+rh ccdcdbcc
+rh cd
+rh cdaaabbdbccc
+rh cdaaabbdbccc
+rh cdaadbdbabcabc
+rh cdaadbdbabcabc
+rh cdacddbdcabcdda
+rh cdacddbdcabcdda
+rh cdadaababca
+rh cdadddddcbada
+rh cdadddddcbada
+rh cdadddddcbada
+rh cdadddddcbada
+rh cdadddddcbada
+rh cdb
+rh cdbaaacdbda
+rh cdbaadaabcbabd
+rh cdbaadaabcbabd
+rh cdbacbaaac
+rh cdbacbddbdcc
+rh cdbbdbbabbcb
+rh cdbbdbbabbcb
+rh cdbcbbdaab
+rh cdbccada
+rh cdbdbbbba
+rh cdbdbbbba
+rh cdcabcbdd
+rh cdcbddcdbdadd
+rh cdcbddcdbdadd
+rh cdcbddcdbdadd
+rh cdcccbbcdaa
+rh cdcccbbcdaa
+rh cdcccbbcdaa
+rh cdcddccccbd
+rh cdcddd
+rh cdda
+rh cdda
+rh cddaabadadbdaa
+rh cddacadbc
+rh cddacadbc
+rh cddacdab
+rh cddbbcbbda
+rh cddbcb
+rh cddcbaddbaaacdc
+rh cddcddbabca
+rh cddcddbabca
+rh cddda
+rh cddda
+rh cdddcbdcabbc
+rh cdddcbdcabbc
+rh cddddddcaa
+rh da
+rh da
+rh da
+rh da
+rh daaac
+rh daaac
+rh daab
+rh daabccdbaa
+rh daabccdbaa
+rh daacaabadc
+rh daacbacddabada
+rh daacbacddabada
+rh daacbdaacbbadb
+rh daacd
+rh daacd
+rh daad
+rh daadcacbdcdaac
+rh daadcacbdcdaac
+rh dab
+rh dabaad
+rh dabab
+rh dabab
+rh dabbdcda
+rh dabbdcda
+rh dabcbbdaddd
+rh dabcdba
+rh dabd
+rh dabd
+rh dabd
+rh dabdaadcdbbcbbc
+rh dabdaadcdbbcbbc
+rh dabdaadcdbbcbbc
+rh dac
+rh dacabbacbab
+rh dacb
+rh dacb
+rh dacb
+rh dacbbbcddbbabca
+rh dacbcdcbb
+rh dacccacdacbbad
+rh dacccacdacbbad
+rh dacccd
+rh daccdc
+rh daccdc
+rh daccddab
+rh daccddab
+rh daccddab
+rh daccddadcbdadc
+rh dacdac
+rh dacdaccdab
+rh dacdcbbbdd
+rh dacdcbbbdd
+rh dacdcbbc
+rh dad
+rh dad
+rh dadaa
+rh dadaa
+rh dadaa
+rh dadaa
+rh dadaaa
+rh dadabdcadbdbcb
+rh dadadbaadcacd
+rh dadadd
+rh dadadd
+rh dadadd
+rh dadb
+rh dadb
+rh dadbaca
+rh dadbaca
+rh dadbaca
+rh dadbaca
+rh dadbbaabc
+rh dadbbaabc
+rh dadbbaabc
+rh dadbbaabc
+rh dadbbcdb
+rh dadbcaacadc
+rh dadc
+rh dadcbccabdaca
+rh dadccab
+rh daddabdbacbbbad
+rh daddbcab
+rh db
+rh db
+rh db
+rh db
+rh db
+rh db
+rh dba
+rh dbaaddddd
+rh dbaaddddd
+rh dbaaddddd
+rh dbaaddddd
+rh dbabc
+rh dbabcba
+rh dbaccbabbccdd
+rh dbaccbabbccdd
+rh dbaccdbacbccddd
+rh dbadbbddbbdcd
+rh dbadcc
+rh dbadcc
+rh dbb
+rh dbbaaac
+rh dbbaaac
+rh dbbadadadcadd
+rh dbbadadadcadd
+rh dbbadadadcadd
+rh dbbb
+rh dbbbacbda
+rh dbbbacbda
+rh dbbbacbda
+rh dbbbb
+rh dbbca
+rh dbbca
+rh dbbcdaacc
+rh dbbcdaacc
+rh dbbdaab
+rh dbbdaab
+rh dbbdadcdaccca
+rh dbbdbdbdccacabc
+rh dbbdbdbdccacabc
+rh dbcabbcbcaba
+rh dbcbdbdcdaadc
+rh dbcbdbdcdaadc
+rh dbccabdbbbdbdcd
+rh dbccabdbbbdbdcd
+rh dbccbdccdab
+rh dbcddbc
+rh dbd
+rh dbd
+rh dbd
+rh dbd
+rh dbdacda
+rh dbdada
+rh dbdada
+rh dbdc
+rh dbdcabdcbd
+rh dbdcabdcbd
+rh dbdcbccadbbdbac
+rh dbdcbdbdccaacaa
+rh dbdccbdadbddbd
+rh dbdccbdadbddbd
+rh dbddbd
+rh dc
+rh dc
+rh dca
+rh dca
+rh dca
+rh dcaa
+rh dcaa
+rh dcaa
+rh dcaa
+rh dcabaddb
+rh dcabbabcbbaaa
+rh dcabbabcbbaaa
+rh dcabbabcbbaaa
+rh dcabdabd
+rh dcabdacbac
+rh dcabdaddbdcdc
+rh dcacb
+rh dcacb
+rh dcacb
+rh dcacb
+rh dcacb
+rh dcaccdd
+rh dcaccdd
+rh dcaddbcadbcabba
+rh dcaddbcadbcabba
+rh dcbadcacbdda
+rh dcbbaaacacba
+rh dcbbdcdcbdc
+rh dcbbdcdcbdc
+rh dcbcddbdab
+rh dcbcddbdab
+rh dcbdbccdbcaba
+rh dcbdcaacdbbbcba
+rh dcbdcddbadac
+rh dcbdcddcba
+rh dcbdcddcba
+rh dccaaaabdcaad
+rh dccaad
+rh dccadbdbac
+rh dccbbbdd
+rh dcccabcbdccbbda
+rh dccccbacccaa
+rh dcccdacbacdaaca
+rh dccdaddbcd
+rh dccdaddbcd
+rh dccdd
+rh dccddcbcdd
+rh dcdbabcccabd
+rh dcdbabcccabd
+rh dcdbabcccabd
+rh dcdbddcaddaacdd
+rh dcdca
+rh dcdca
+rh dcdcdcab
+rh dcdcdcab
+rh dcdcdcdc
+rh dcddbdda
+rh ddaaadcabaacacd
+rh ddaaba
+rh ddaabcbada
+rh ddaabcbada
+rh ddaba
+rh ddabbacbabb
+rh ddabbacbabb
+rh ddabbacbabb
+rh ddabbadaadcdadd
+rh ddabbcc
+rh ddabbcc
+rh ddabcaacc
+rh ddabcaacc
+rh ddabcaacc
+rh ddaca
+rh ddaca
+rh ddacdaddbacb
+rh ddacdaddbacb
+rh ddadbaccddda
+rh ddaddbd
+rh ddaddbd
+rh ddbaad
+rh ddbaad
+rh ddbacacabdbbc
+rh ddbadaadaaba
+rh ddbba
+rh ddbbaaca
+rh ddbbbca
+rh ddbbcacc
+rh ddbbcbadbaabb
+rh ddbbccbabaabb
+rh ddbbdadaabdaab
+rh ddbbdbcaaaccbd
+rh ddbcdacdcadadc
+rh ddbdadc
+rh ddbdadc
+rh ddbdadc
+rh ddbdadd
+rh ddbdc
+rh ddcadddbbba
+rh ddcadddbbba
+rh ddcadddbbba
+rh ddcbaddabdabc
+rh ddcbbaaddca
+rh ddcbddaacdad
+rh ddccccbacacbbd
+rh ddccccbacacbbd
+rh ddccdacdaddbb
+rh ddcd
+rh ddcdbdabd
+rh ddcdbdabd
+rh ddcdbdabd
+rh ddcdbdabd
+rh ddcdcdbac
+rh ddcdcdbac
+rh ddcdddddcdcd
+rh ddcdddddcdcd
+rh ddd
+rh ddd
+rh dddaaaabdcdbacc
+rh dddaadbabbc
+rh dddadbabbc
+rh dddadbabbc
+rh dddadbabbc
+rh dddadcaccd
+rh dddadcaccd
+rh dddbb
+rh dddc
+rh dddcaa
+rh dddcbaacdcba
+rh dddcbacaccddcca
+rh ddddba
+rh ddddba
+rh ddddbcaa
+rh ddddbcaa
+size
+free
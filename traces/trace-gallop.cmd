@@ -0,0 +1,27 @@
+# Test of list_sort with galloping merges on sorted, reverse, nearly-sorted
+# and random input
+option fail 0
+option malloc 0
+option bench 1
+option gallop 1
+new
+ih RAND 100000
+sort
+list_sort
+reverse
+list_sort
+reverseK 8
+list_sort
+it RAND 1000
+list_sort
+free
+new
+ih RAND 100000
+it aardvark 500
+list_sort
+option order desc
+list_sort
+option lsort_generic 1
+reverse
+list_sort
+free
@@ -0,0 +1,65 @@
+# Test of q_insert_sorted on empty queues and on queues sorted again after
+# unsorted inserts and a reversal, of the skip-list index kept through the
+# head and tail operations, of inserting a long run in order, and of a failed
+# insertion, which leaves the queue as it was
+option fail 0
+option malloc 0
+new
+is lion
+is cat
+is zebra
+is cat
+rh cat
+rh cat
+rt zebra
+it ape
+sort
+is bear
+rh ape
+rh bear
+ih yak
+sort
+is mole
+rh lion
+rh mole
+rh yak
+ih dog
+it ant
+ih fox
+reverse
+sort
+is cow
+rh ant
+rh cow
+rh dog
+rh fox
+is eel
+dm
+is gnu
+reverse
+rh gnu
+free
+new
+is RAND 100000
+it zzzzzzzzzz 1000
+is zzzzzzzzzy
+rt zzzzzzzzzz
+ih aaa 1000
+is aab
+is aaa
+rh aaa
+rt zzzzzzzzzz
+is aaaa 100000
+free
+new
+it b
+it a
+sort
+option fail 10
+option malloc 100
+is c
+option malloc 0
+option fail 0
+rh a
+rh b
+free
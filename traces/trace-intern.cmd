@@ -0,0 +1,45 @@
+# Test queues that share one copy of equal strings through an intern table:
+# repeated inserts, removes, dedup and sort on shared strings, a merge of
+# queues with their own tables and without one, and tables left behind by a
+# freed queue until its elements are released
+option fail 0
+option malloc 0
+new intern
+ih dolphin 1000
+it gerbil 1000
+ih https://example.com/item/00000001 10
+it https://example.com/item/00000001
+rh https://example.com/item/00000001
+rt https://example.com/item/00000001
+it zebra
+mem
+sort
+rh dolphin
+dedup
+rh zebra
+free
+option intern 1
+new compact
+it bear 3
+it yak
+new
+it cat 2
+it mole
+new malloc
+option intern 0
+it ant
+it bear
+merge
+rh ant
+dedup
+rh mole
+rh yak
+free
+new slab intern
+ih meerkat 100
+reverse
+it lion
+sort
+rh lion
+mem
+free
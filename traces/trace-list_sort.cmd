@@ -1,6 +1,7 @@
 # Test the speed of list_sort
 option fail 0
 option malloc 0
+option bench 1
 new
 ih RAND 500000
 time list_sort
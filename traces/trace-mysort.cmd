@@ -1,6 +1,7 @@
 # Test the speed of mysort
 option fail 0
 option malloc 0
+option bench 1
 new
 ih RAND 500000
 time sort
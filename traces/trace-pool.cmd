@@ -0,0 +1,55 @@
+# Test insert, remove, merge and free of queues backed by a slab pool,
+# with one size of element or each at its own size, picked by option or
+# for each queue
+option fail 0
+option malloc 0
+option pool 1
+new
+ih dolphin 1000
+it gerbil 1000
+rh dolphin
+rt gerbil
+ih meerkat
+it abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz
+dm
+dedup
+sort
+new
+it bear
+it zebra
+option pool 0
+new
+it cat
+merge
+rh abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz
+size
+free
+option pool 2
+new
+ih dolphin 1000
+it abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz 10
+it a
+rh dolphin
+rt a
+ih ant
+rh ant
+ih x
+mem
+option pool 1
+new
+ih gerbil 10
+merge
+rh abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz
+mem
+free
+new compact
+it cat
+new malloc
+it ant
+new slab
+it bee
+merge
+rh ant
+rh bee
+rh cat
+free
@@ -0,0 +1,9 @@
+# Test the speed of the radix engine of q_sort
+option fail 0
+option malloc 0
+option bench 1
+option sortalgo radix
+new
+ih RAND 500000
+time sort
+free
@@ -0,0 +1,72 @@
+# Test of the head and tail operations, show, sort and the other queue
+# operations on reversed queues
+option fail 0
+option malloc 0
+new
+it b
+it c
+ih a
+reverse
+show
+ih d
+it z
+rh d
+rt z
+rh c
+ih c
+reverse
+reverse
+it aa
+rt aa
+dm
+rh c
+rh a
+ih gerbil
+it dolphin
+ih bear
+reverse
+sort
+rh bear
+rh dolphin
+rh gerbil
+new
+it meerkat
+it eagle
+it cat
+reverse
+new
+it bear
+it fox
+reverse
+reverse
+merge
+rh bear
+rh cat
+rh eagle
+rh fox
+rh meerkat
+it a
+it b
+it c
+it d
+reverse
+swap
+rh c
+rh d
+rh a
+rh b
+it b
+it c
+it a
+reverse
+descend
+rh c
+rh b
+free
+new
+ih dolphin 1000000
+it gerbil 1000000
+time reverse
+rh gerbil
+rt dolphin
+free
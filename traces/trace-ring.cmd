@@ -0,0 +1,62 @@
+# Test a queue with a ring index of its elements: head and tail operations
+# past several doublings of the ring, sort, reverseK and swap on the ring,
+# operations that leave it stale, a merge it has no room for, and
+# constant-time insert and remove
+option fail 0
+option malloc 0
+new ringindex
+it b 20
+ih a 20
+it c
+rh a
+rt c
+reverseK 3
+sort
+rh a
+swap
+reverse
+reverseK 4
+ih d
+it 0
+sort
+rh 0
+rt d
+dm
+ih z
+sort
+rt z
+free
+new ringindex
+ih gerbil
+ih bear
+ih dolphin
+reverse
+it meerkat
+reverseK 2
+rh bear
+rh gerbil
+rh meerkat
+rh dolphin
+it mole
+it yak
+ih lion
+dedup
+sort
+rh lion
+rh mole
+rh yak
+free
+new ringindex
+ih RAND 1000
+new
+ih RAND 1000
+merge
+sort
+free
+option pool ringindex
+option simulation 1
+it
+ih
+rh
+rt
+option simulation 0
@@ -0,0 +1,241 @@
+# Test of q_sort picking its engine from a sample of random, reverse-sorted
+# and duplicate-heavy input, and of the engines on their own
+option fail 0
+option malloc 0
+option sortalgo auto
+option sortstats 1
+new
+ih RAND 100000
+sort
+reverse
+sort
+free
+new
+ih RAND 10000
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+ih mole 5
+ih zebra 5
+ih aardvark 5
+sort
+free
+new
+ih RAND 5000
+sort
+free
+option sortalgo list
+new
+ih RAND 100000
+sort
+free
+option threads 4
+option sortalgo auto
+new
+ih RAND 100000
+sort
+free
@@ -0,0 +1,12 @@
+# Test of external sort through temporary files under several budgets
+option fail 0
+option malloc 0
+new
+ih RAND 100000
+it aaa 100
+sort_external 16384
+ih RAND 50000
+sort_external 65536
+reverse
+sort_external 100000000
+free
@@ -0,0 +1,81 @@
+# Test that sorts and dedup order strings by every byte, across the key
+# prefix and past it: lowercase runs of up to 13 letters sharing long
+# prefixes, upper case, digits, punctuation and bytes past 'z', as built
+# with or without KEY_PACK=1
+option fail 0
+option malloc 0
+new
+it abcdefghijkl
+it abcdefghijk
+it abcdefghijklm
+it abcdefghijkla
+it abcdefghij
+it abcdefghijkz
+it abcdefghijk~
+it abcdefghijk{
+it abcdefghijkA
+it abcdefghijk0
+it abcdefghijk
+it Abcdefghijk
+it abcdefghijkl
+it zzzzzzzzzzzzz
+it zzzzzzzzzzzz
+it zzzzzzzzzzz~
+it z
+it ~
+it }a
+it |
+it a~
+it a{a
+it a
+it 0
+it 9a
+it a0
+it a9
+it aZ
+it a_
+it a`
+it a!
+it http://example.com/item/0000002
+it http://example.com/item/0000001
+it http://example.com/item/00000010
+it dolphin
+it dolphin
+it dolphins
+it AA 20
+it A 20
+option sortalgo radix
+sort
+reverseK 3
+option sortalgo list
+sort
+reverseK 2
+option sortalgo merge
+sort
+reverse
+list_sort
+dedup
+rh 0
+rh 9a
+rh Abcdefghijk
+rh a
+free
+new ringindex
+ih abcdefghijkl 40
+ih abcdefghijkm 40
+ih abcdefghijkk 40
+ih abcdefghijk 40
+ih abcdefghijkl~ 40
+sort
+rh abcdefghijk
+new
+ih abcdefghijkl 40
+ih abcdefghijklm 40
+ih abcdefghijkk 40
+option sortalgo radix
+sort
+option sortalgo merge
+merge
+rt abcdefghijkm
+rh abcdefghijk
+free
@@ -0,0 +1,37 @@
+# Test of sorting queues known to be sorted, reversed after sorting, or
+# grown out of order, and of merging queues that are not sorted
+option fail 0
+option malloc 0
+option sortstats 1
+new
+it bear
+it cat
+ih ant
+it cat
+sort
+reverse
+sort
+rh ant
+it ape
+sort
+rh ape
+rh bear
+new
+it zebra
+it fox
+ih yak
+merge
+rh cat
+rh cat
+rh fox
+rh yak
+rh zebra
+free
+new
+ih dolphin 1000000
+it gerbil 1000000
+reverse
+sort
+rh dolphin
+rt gerbil
+free
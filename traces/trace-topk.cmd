@@ -0,0 +1,21 @@
+# Test of top-k and order-statistic selection
+option fail 0
+option malloc 0
+new
+ih RAND 1000
+it meerkat 5
+ih meerkat 5
+topk 10
+topk 10 largest
+select 0
+select 500
+select 0 largest
+topk 2000
+new
+ih RAND 1000
+topk 20 discard
+size
+select 3 largest discard
+size
+free
+free